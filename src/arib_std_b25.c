@@ -7,6 +7,8 @@
 #include "multi2.h"
 #include "ts_common_types.h"
 #include "ts_section_parser.h"
+#include "ts_sync_scanner.h"
+#include "ts_header_soa.h"
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  inner structures
@@ -64,6 +66,8 @@ typedef struct {
 	int32_t            unpurchased;
 	int32_t            last_error;
 
+	int32_t            slot;
+
 	void              *prev;
 	void              *next;
 
@@ -78,21 +82,65 @@ typedef struct {
 typedef struct {
 	uint32_t           ref;
 	uint32_t           type;
-	int64_t            normal_packet;
-	int64_t            undecrypted;
 	void              *target;
 } PID_MAP;
 
+typedef struct {
+	int64_t            normal_packet;
+	int64_t            undecrypted;
+} PID_STAT;
+
+/* pid_hot[] values, a byte per PID mirroring map[] for the packet loop */
+enum PID_HOT {
+	PID_HOT_UNKNOWN                             = 0x00, /* map type UNKNOWN                  */
+	PID_HOT_SLOT_MAX                            = 0xfd, /* 0x01-0xfd stream, dec_slot[] index */
+	PID_HOT_STREAM                              = 0xfe, /* stream, decryptor in map[].target */
+	PID_HOT_SECTION                             = 0xff, /* any other map type                */
+};
+
+/* packets taken by one pass of the decode pipeline, see collect_packets() */
+#define PACKET_BATCH_MAX 256
+
+typedef struct {
+	int32_t            count;
+	uint8_t           *packet[PACKET_BATCH_MAX];
+	uint8_t           *payload[PACKET_BATCH_MAX];
+	int32_t            size[PACKET_BATCH_MAX];
+	int32_t            type[PACKET_BATCH_MAX];
+	DECRYPTOR_ELEM    *dec[PACKET_BATCH_MAX];
+	/* one decryptor's share, gathered for MULTI2::decrypt_batch() */
+	uint8_t           *buf[PACKET_BATCH_MAX];
+	int32_t            len[PACKET_BATCH_MAX];
+	int32_t            parity[PACKET_BATCH_MAX];
+	/* header of the PSI/ECM/EMM packet that ended the batch */
+	TS_HEADER          section;
+	/* headers of the packet run being classified */
+	TS_HEADER_SOA      hdr;
+} PACKET_BATCH;
+
 typedef struct {
 
 	int32_t            multi2_round;
 	int32_t            strip;
 	int32_t            emm_proc_on;
+	int32_t            pull;
 	
 	int32_t            unit_size;
 
+	const TS_SYNC_SCANNER *sync;
+	const TS_HEADER_EXTRACTOR *hdr;
+
 	int32_t            sbuf_offset;
 
+	/* buffers of every section parser below */
+	TS_SECTION_SLAB   *slab;
+
+	/* what put_section() hands to and gets back from the section
+	   callbacks, see on_pat_section() and the rest */
+	void              *sect_target;
+	int32_t            sect_count;
+	int32_t            sect_result;
+
 	TS_SECTION_PARSER *pat;
 	TS_SECTION_PARSER *cat;
 
@@ -105,6 +153,16 @@ typedef struct {
 
 	PID_MAP            map[0x2000];
 
+	/* what the packet loop reads per packet, 8KB + 2KB instead of the
+	   256KB map, kept in step with map[] by update_pid_hot() */
+	uint8_t            pid_hot[0x2000];
+	DECRYPTOR_ELEM    *dec_slot[PID_HOT_SLOT_MAX+1];
+
+	/* only ever written by the packet loop */
+	PID_STAT           stat[0x2000];
+
+	PACKET_BATCH       batch;
+
 	B_CAS_CARD        *bcas;
 	B_CAS_ID           casid;
 	int32_t            ca_system_id;
@@ -308,6 +366,35 @@ enum PID_MAP_TYPE {
 	PID_MAP_TYPE_OTHER                          = 0xff00,
 };
 
+enum PACKET_ACTION {
+	PACKET_PASS                                 = 0x0000, /* keep the packet                      */
+	PACKET_DROP                                 = 0x0001, /* stripped null packet                 */
+	PACKET_BROKEN                               = 0x0002, /* not a packet, retry at the next byte */
+	PACKET_SECTION                              = 0x0003, /* keep it and feed its section parser  */
+	PACKET_PAT                                  = 0x0004, /* a new PAT was applied                */
+};
+
+enum PACKET_SCAN {
+	PACKET_SCAN_STREAM                          = 0x0000, /* put()/get_into(), needs the next sync byte */
+	PACKET_SCAN_INPLACE                         = 0x0001, /* process_inplace(), last packet may be bare */
+	PACKET_SCAN_FLUSH                           = 0x0002, /* flush(), whatever whole packets are left   */
+};
+
+enum PACKET_BATCH_END {
+	PACKET_BATCH_FULL                           = 0x0000,
+	PACKET_BATCH_SECTION                        = 0x0001, /* the last packet is a PSI/ECM/EMM packet */
+	PACKET_BATCH_INPUT                          = 0x0002, /* no more packets in the input            */
+};
+
+/* C90 has no inline, the per packet kernel is worth forcing */
+#if defined(__GNUC__)
+#define PACKET_INLINE __inline__ __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define PACKET_INLINE __forceinline
+#else
+#define PACKET_INLINE
+#endif
+
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  function prottypes (interface method)
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
@@ -322,6 +409,8 @@ static int put_arib_std_b25(void *std_b25, ARIB_STD_B25_BUFFER *buf);
 static int get_arib_std_b25(void *std_b25, ARIB_STD_B25_BUFFER *buf);
 static int get_program_count_arib_std_b25(void *std_b25);
 static int get_program_info_arib_std_b25(void *std_b25, ARIB_STD_B25_PROGRAM_INFO *info, int idx);
+static int process_inplace_arib_std_b25(void *std_b25, uint8_t *buf, int32_t size, int32_t *consumed);
+static int get_into_arib_std_b25(void *std_b25, uint8_t *dst, int32_t cap, int32_t *written);
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  global function implementation
@@ -341,7 +430,15 @@ ARIB25_API_EXPORT ARIB_STD_B25 *create_arib_std_b25()
 		return NULL;
 	}
 
+	prv->slab = create_ts_section_slab();
+	if(prv->slab == NULL){
+		free(prv);
+		return NULL;
+	}
+
 	prv->multi2_round = 4;
+	prv->sync = select_ts_sync_scanner();
+	prv->hdr = select_ts_header_extractor();
 
 	r = (ARIB_STD_B25 *)(prv+1);
 	r->private_data = prv;
@@ -357,6 +454,8 @@ ARIB25_API_EXPORT ARIB_STD_B25 *create_arib_std_b25()
 	r->get = get_arib_std_b25;
 	r->get_program_count = get_program_count_arib_std_b25;
 	r->get_program_info = get_program_info_arib_std_b25;
+	r->process_inplace = process_inplace_arib_std_b25;
+	r->get_into = get_into_arib_std_b25;
 
 	return r;
 }
@@ -366,21 +465,38 @@ ARIB25_API_EXPORT ARIB_STD_B25 *create_arib_std_b25()
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 static ARIB_STD_B25_PRIVATE_DATA *private_data(void *std_b25);
 static void teardown(ARIB_STD_B25_PRIVATE_DATA *prv);
+static int proc_head(ARIB_STD_B25_PRIVATE_DATA *prv);
 static int select_unit_size(ARIB_STD_B25_PRIVATE_DATA *prv);
 static int find_pat(ARIB_STD_B25_PRIVATE_DATA *prv);
-static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv);
+static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect);
 static int check_pmt_complete(ARIB_STD_B25_PRIVATE_DATA *prv);
 static int find_pmt(ARIB_STD_B25_PRIVATE_DATA *prv);
-static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm);
+static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm, TS_SECTION *sect);
 static int32_t find_ca_descriptor_pid(uint8_t *head, uint8_t *tail, int32_t ca_system_id);
 static int32_t add_ecm_stream(ARIB_STD_B25_PRIVATE_DATA *prv, TS_STREAM_LIST *list, int32_t ecm_pid);
 static int check_ecm_complete(ARIB_STD_B25_PRIVATE_DATA *prv);
 static int find_ecm(ARIB_STD_B25_PRIVATE_DATA *prv);
-static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round);
-static int proc_arib_std_b25(ARIB_STD_B25_PRIVATE_DATA *prv);
-
-static int proc_cat(ARIB_STD_B25_PRIVATE_DATA *prv);
-static int proc_emm(ARIB_STD_B25_PRIVATE_DATA *prv);
+static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round, TS_SECTION *sect);
+static int proc_arib_std_b25(ARIB_STD_B25_PRIVATE_DATA *prv, TS_WORK_BUFFER *dst, int32_t grow);
+static int proc_arib_std_b25_inplace(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t *head, uint8_t *tail, uint8_t **done);
+static int classify_packet(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t *curr, int32_t i, int32_t strip);
+static int32_t packet_run(uint8_t *curr, uint8_t *tail, int32_t unit, int32_t scan, int32_t max);
+static int collect_packets(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t **curr, uint8_t *tail, int32_t scan, int32_t max);
+static int decrypt_packets(ARIB_STD_B25_PRIVATE_DATA *prv);
+static int route_section(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t *action);
+static int proc_section_packet(ARIB_STD_B25_PRIVATE_DATA *prv, TS_HEADER *hdr, uint8_t *p, int32_t n, int32_t *action);
+
+static TS_SECTION_PARSER *create_section_parser(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION_CALLBACK callback);
+static int put_section(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION_PARSER *parser, void *target, TS_HEADER *hdr, uint8_t *p, int32_t n, int error);
+static int count_section(ARIB_STD_B25_PRIVATE_DATA *prv, int r);
+static int on_pat_section(void *ctx, TS_SECTION *sect);
+static int on_pmt_section(void *ctx, TS_SECTION *sect);
+static int on_ecm_section(void *ctx, TS_SECTION *sect);
+static int on_cat_section(void *ctx, TS_SECTION *sect);
+static int on_emm_section(void *ctx, TS_SECTION *sect);
+
+static int proc_cat(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect);
+static int proc_emm(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect);
 
 static void release_program(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm);
 
@@ -390,6 +506,7 @@ static DECRYPTOR_ELEM *set_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid
 static void remove_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, DECRYPTOR_ELEM *dec);
 static DECRYPTOR_ELEM *select_active_decryptor(DECRYPTOR_ELEM *a, DECRYPTOR_ELEM *b, int32_t pid);
 static void bind_stream_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid, DECRYPTOR_ELEM *dec);
+static void update_pid_hot(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid);
 static void unlock_all_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv);
 
 static TS_STREAM_ELEM *get_stream_list_head(TS_STREAM_LIST *list);
@@ -400,14 +517,17 @@ static void clear_stream_list(TS_STREAM_LIST *list);
 
 static int reserve_work_buffer(TS_WORK_BUFFER *buf, int32_t size);
 static int append_work_buffer(TS_WORK_BUFFER *buf, uint8_t *data, int32_t size);
+static int append_span(TS_WORK_BUFFER *buf, uint8_t **head, uint8_t **tail, uint8_t *curr);
+static int stage_work_buffer(TS_WORK_BUFFER *buf, uint8_t *data, int32_t size);
+static void consume_work_buffer(TS_WORK_BUFFER *buf, uint8_t *curr);
 static void reset_work_buffer(TS_WORK_BUFFER *buf);
 static void release_work_buffer(TS_WORK_BUFFER *buf);
 
 static void extract_ts_header(TS_HEADER *dst, uint8_t *src);
 static void extract_emm_fixed_part(EMM_FIXED_PART *dst, uint8_t *src);
 
-static uint8_t *resync(uint8_t *head, uint8_t *tail, int32_t unit);
-static uint8_t *resync_force(uint8_t *head, uint8_t *tail, int32_t unit);
+static uint8_t *resync(const TS_SYNC_SCANNER *sync, uint8_t *head, uint8_t *tail, int32_t unit);
+static uint8_t *resync_force(const TS_SYNC_SCANNER *sync, uint8_t *head, uint8_t *tail, int32_t unit);
 
 /* static uint32_t crc32(uint8_t *head, uint8_t *tail); */
 
@@ -424,6 +544,7 @@ static void release_arib_std_b25(void *std_b25)
 	}
 
 	teardown(prv);
+	prv->slab->release(prv->slab);
 	free(prv);
 }
 
@@ -513,19 +634,16 @@ static int reset_arib_std_b25(void *std_b25)
 static int flush_arib_std_b25(void *std_b25)
 {
 	int r;
-	int m,n;
+	int i,m,n;
 
-	int32_t crypt;
-	int32_t unit;
-	int32_t pid;
+	int32_t end;
+	int32_t action;
 
-	uint8_t *p;
 	uint8_t *curr;
 	uint8_t *tail;
 
-	TS_HEADER hdr;
-	DECRYPTOR_ELEM *dec;
-	TS_PROGRAM *pgrm;
+	uint8_t *span_head;
+	uint8_t *span_tail;
 
 	ARIB_STD_B25_PRIVATE_DATA *prv;
 
@@ -541,15 +659,17 @@ static int flush_arib_std_b25(void *std_b25)
 		}
 	}
 
-	r = proc_arib_std_b25(prv);
+	r = proc_arib_std_b25(prv, &(prv->dbuf), 1);
 	if(r < 0){
 		return r;
 	}
 
-	unit = prv->unit_size;
 	curr = prv->sbuf.head;
 	tail = prv->sbuf.tail;
 
+	span_head = curr;
+	span_tail = curr;
+
 	m = prv->dbuf.tail - prv->dbuf.head;
 	n = tail - curr;
 	if(!reserve_work_buffer(&(prv->dbuf), m+n)){
@@ -558,220 +678,44 @@ static int flush_arib_std_b25(void *std_b25)
 
 	r = 0;
 
-	while( (curr+188) <= tail ){
-		
-		if(curr[0] != 0x47){
-			p = resync_force(curr, tail, unit);
-			if(p == NULL){
-				goto LAST;
-			}
-			curr = p;
-		}
-		
-		extract_ts_header(&hdr, curr);
-		crypt = hdr.transport_scrambling_control;
-		pid = hdr.pid;
-
-		if(hdr.transport_error_indicator != 0){
-			/* bit error - append output buffer without parsing */
-			if(!append_work_buffer(&(prv->dbuf), curr, 188)){
-				r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-				goto LAST;
-			}
-			goto NEXT;
-		}
-		
-		if( (pid == 0x1fff) && (prv->strip) ){
-			goto NEXT;
-		}
-		
-		p = curr+4;
-		if(hdr.adaptation_field_control & 0x02){
-			p += (p[0]+1);
-		}
-		n = 188 - (p-curr);
-		if( (n < 1) && ((n < 0) || (hdr.adaptation_field_control & 0x01)) ){
-			/* broken packet */
-			curr += 1;
-			continue;
-		}
-
-		if( (crypt != 0) &&
-		    (hdr.adaptation_field_control & 0x01) ){
-			
-			if(prv->map[pid].type == PID_MAP_TYPE_OTHER){
-				dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
-			}else if( (prv->map[pid].type == 0) &&
-				  (prv->decrypt.count == 1) ){
-				dec = prv->decrypt.head;
-			}else{
-				dec = NULL;
-			}
+	end = PACKET_BATCH_FULL;
+	while(end != PACKET_BATCH_INPUT){
 
-			if( (dec != NULL) && (dec->m2 != NULL) ){
-				m = dec->m2->decrypt(dec->m2, crypt, p, n);
-				if(m < 0){
-					r = ARIB_STD_B25_ERROR_DECRYPT_FAILURE;
-					goto LAST;
-				}
-				curr[3] &= 0x3f;
-				prv->map[pid].normal_packet += 1;
-			}else{
-				prv->map[pid].undecrypted += 1;
-			}
-		}else{
-			prv->map[pid].normal_packet += 1;
-		}
+		end = collect_packets(prv, &curr, tail, PACKET_SCAN_FLUSH, PACKET_BATCH_MAX);
 
-		if(!append_work_buffer(&(prv->dbuf), curr, 188)){
-			r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+		m = decrypt_packets(prv);
+		if(m < 0){
+			r = m;
+			curr = prv->batch.packet[0];
 			goto LAST;
 		}
 
-		if(prv->map[pid].type == PID_MAP_TYPE_ECM){
-			dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
-			if( (dec == NULL) || (dec->ecm == NULL) ){
-				/* this code will never execute */
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = dec->ecm->put(dec->ecm, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = dec->ecm->get_count(dec->ecm);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_ecm(dec, prv->bcas, prv->multi2_round);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(prv->map[pid].type == PID_MAP_TYPE_PMT){
-			pgrm = (TS_PROGRAM *)(prv->map[pid].target);
-			if( (pgrm == NULL) || (pgrm->pmt == NULL) ){
-				/* this code will never execute */
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = pgrm->pmt->put(pgrm->pmt, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = pgrm->pmt->get_count(pgrm->pmt);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_pmt(prv, pgrm);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(prv->map[pid].type == PID_MAP_TYPE_EMM){
-			if( prv->emm_proc_on == 0){
-				goto NEXT;
-			}
-			if( prv->emm == NULL ){
-				prv->emm = create_ts_section_parser();
-				if(prv->emm == NULL){
-					r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-					goto LAST;
-				}
-			}
-			m = prv->emm->put(prv->emm, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = prv->emm->get_count(prv->emm);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_emm(prv);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(pid == 0x0001){
-			if( prv->cat == NULL ){
-				prv->cat = create_ts_section_parser();
-				if(prv->cat == NULL){
-					r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-					goto LAST;
-				}
-			}
-			m = prv->cat->put(prv->cat, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = prv->cat->get_count(prv->cat);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_cat(prv);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(pid == 0x0000){
-			if( prv->pat == NULL ){
-				prv->pat = create_ts_section_parser();
-				if(prv->pat == NULL){
-					r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-					goto LAST;
-				}
-			}
-			m = prv->pat->put(prv->pat, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
+		for(i=0;i<prv->batch.count;i++){
+			if(!append_span(&(prv->dbuf), &span_head, &span_tail, prv->batch.packet[i])){
+				r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+				curr = prv->batch.packet[i];
 				goto LAST;
 			}
-			m = prv->pat->get_count(prv->pat);
+		}
+
+		if(end == PACKET_BATCH_SECTION){
+			m = route_section(prv, &action);
 			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
+				r = m;
 				goto LAST;
 			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_pat(prv);
-			if(r < 0){
-				goto LAST;
+			if(m > 0){
+				r = m;
 			}
 		}
-			
-	NEXT:
-		curr += unit;
 	}
 
 LAST:
-	
-	m = curr - prv->sbuf.head;
-	n = tail - curr;
-	if( (n < 1024) || (m > (prv->sbuf.max/2) ) ){
-		p = prv->sbuf.pool;
-		memcpy(p, curr, n);
-		prv->sbuf.head = p;
-		prv->sbuf.tail = p+n;
-	}else{
-		prv->sbuf.head = curr;
+	if(!append_work_buffer(&(prv->dbuf), span_head, span_tail-span_head)){
+		r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 	}
+	
+	consume_work_buffer(&(prv->sbuf), curr);
 
 	return r;
 }
@@ -787,73 +731,22 @@ static int put_arib_std_b25(void *std_b25, ARIB_STD_B25_BUFFER *buf)
 		return ARIB_STD_B25_ERROR_INVALID_PARAM;
 	}
 
-	if(!append_work_buffer(&(prv->sbuf), buf->data, buf->size)){
+	if(!stage_work_buffer(&(prv->sbuf), buf->data, buf->size)){
 		return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 	}
 
-	if(prv->unit_size < 188){
-		n = select_unit_size(prv);
-		if(n < 0){
-			return n;
-		}
-		if(prv->unit_size < 188){
-			/* need more data */
-			return 0;
-		}
-	}
-
-	if(prv->p_count < 1){
-		n = find_pat(prv);
-		if(n < 0){
-			return n;
-		}
-		if(prv->p_count < 1){
-			if(prv->sbuf_offset < (16*1024*1024)){
-				/* need more data */
-				return 0;
-			}else{
-				/* exceed sbuf limit */
-				return ARIB_STD_B25_ERROR_NO_PAT_IN_HEAD_16M;
-			}
-		}
-		prv->sbuf_offset = 0;
-	}
-
-	if(!check_pmt_complete(prv)){
-		n = find_pmt(prv);
-		if(n < 0){
-			return n;
-		}
-		if(!check_pmt_complete(prv)){
-			if(prv->sbuf_offset < (32*1024*1024)){
-				/* need more data */
-				return 0;
-			}else{
-				/* exceed sbuf limit */
-				return ARIB_STD_B25_ERROR_NO_PMT_IN_HEAD_32M;
-			}
-		}
-		prv->sbuf_offset = 0;
+	n = proc_head(prv);
+	if(n < 1){
+		/* error or need more data */
+		return n;
 	}
 
-	if(!check_ecm_complete(prv)){
-		n = find_ecm(prv);
-		if(n < 0){
-			return n;
-		}
-		if(!check_ecm_complete(prv)){
-			if(prv->sbuf_offset < (32*1024*1024)){
-				/* need more data */
-				return 0;
-			}else{
-				/* exceed sbuf limit */
-				return ARIB_STD_B25_ERROR_NO_ECM_IN_HEAD_32M;
-			}
-		}
-		prv->sbuf_offset = 0;
+	if(prv->pull){
+		/* get_into() decrypts on demand */
+		return 0;
 	}
 
-	return proc_arib_std_b25(prv);
+	return proc_arib_std_b25(prv, &(prv->dbuf), 1);
 }
 
 static int get_arib_std_b25(void *std_b25, ARIB_STD_B25_BUFFER *buf)
@@ -907,15 +800,15 @@ static int get_program_info_arib_std_b25(void *std_b25, ARIB_STD_B25_PROGRAM_INF
 	info->program_number = pgrm->program_number;
 	
 	pid = pgrm->pmt_pid;
-	info->total_packet_count += prv->map[pid].normal_packet;
-	info->total_packet_count += prv->map[pid].undecrypted;
-	info->undecrypted_packet_count += prv->map[pid].undecrypted;
+	info->total_packet_count += prv->stat[pid].normal_packet;
+	info->total_packet_count += prv->stat[pid].undecrypted;
+	info->undecrypted_packet_count += prv->stat[pid].undecrypted;
 
 	pid = pgrm->pcr_pid;
 	if( (pid != 0) && (pid != 0x1fff) ){
-		info->total_packet_count += prv->map[pid].normal_packet;
-		info->total_packet_count += prv->map[pid].undecrypted;
-		info->undecrypted_packet_count += prv->map[pid].undecrypted;
+		info->total_packet_count += prv->stat[pid].normal_packet;
+		info->total_packet_count += prv->stat[pid].undecrypted;
+		info->undecrypted_packet_count += prv->stat[pid].undecrypted;
 	}
 
 	strm = pgrm->streams.head;
@@ -926,55 +819,171 @@ static int get_program_info_arib_std_b25(void *std_b25, ARIB_STD_B25_PROGRAM_INF
 			info->ecm_unpurchased_count += dec->unpurchased;
 			info->last_ecm_error_code = dec->last_error;
 		}
-		info->total_packet_count += prv->map[pid].normal_packet;
-		info->total_packet_count += prv->map[pid].undecrypted;
-		info->undecrypted_packet_count += prv->map[pid].undecrypted;
+		info->total_packet_count += prv->stat[pid].normal_packet;
+		info->total_packet_count += prv->stat[pid].undecrypted;
+		info->undecrypted_packet_count += prv->stat[pid].undecrypted;
 		strm = (TS_STREAM_ELEM *)(strm->next);
 	}
 
 	return 0;
 }
 
-/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- private method implementation
- ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
-static ARIB_STD_B25_PRIVATE_DATA *private_data(void *std_b25)
+/* zero copy variant of put()/get() for callers that own a read buffer.
+
+   decrypts the packets of buf where they are and clears their scrambling
+   bits, nothing is copied into sbuf or dbuf. the first *consumed bytes of
+   buf are final on return, the rest (a partial unit in steady state) is
+   not touched and has to be passed again at the head of the next call.
+
+   until PAT, PMT and ECM have been found *consumed stays 0 and the caller
+   keeps accumulating the stream from the same position, which is scanned
+   in place like sbuf is for put(). the output keeps the input framing:
+   192/204 byte units, null packets and bytes lost to resync stay as they
+   are, and strip is not applied. do not mix with put() on one instance. */
+static int process_inplace_arib_std_b25(void *std_b25, uint8_t *buf, int32_t size, int32_t *consumed)
 {
-	ARIB_STD_B25 *p;
-	ARIB_STD_B25_PRIVATE_DATA *r;
+	int r;
 
-	p = (ARIB_STD_B25 *)std_b25;
-	if(p == NULL){
-		return NULL;
+	uint8_t *done;
+
+	TS_WORK_BUFFER work;
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = private_data(std_b25);
+	if( (prv == NULL) || (buf == NULL) || (size < 0) || (consumed == NULL) ){
+		return ARIB_STD_B25_ERROR_INVALID_PARAM;
 	}
 
-	r = (ARIB_STD_B25_PRIVATE_DATA *)p->private_data;
-	if( ((void *)(r+1)) != ((void *)p) ){
-		return NULL;
+	*consumed = 0;
+
+	if(prv->sbuf.head != prv->sbuf.tail){
+		/* put() data is pending */
+		return ARIB_STD_B25_ERROR_INVALID_PARAM;
 	}
 
-	return r; 
-}
+	/* borrow the caller's buffer as sbuf for the head of stream scan */
+	memcpy(&work, &(prv->sbuf), sizeof(TS_WORK_BUFFER));
+	prv->sbuf.pool = buf;
+	prv->sbuf.head = buf;
+	prv->sbuf.tail = buf+size;
+	prv->sbuf.max = size;
 
-static void teardown(ARIB_STD_B25_PRIVATE_DATA *prv)
-{
-	int i;
-	
-	prv->unit_size = 0;
-	prv->sbuf_offset = 0;
+	r = proc_head(prv);
 
-	if(prv->pat != NULL){
-		prv->pat->release(prv->pat);
-		prv->pat = NULL;
-	}
-	if(prv->cat != NULL){
-		prv->cat->release(prv->cat);
-		prv->cat = NULL;
+	memcpy(&(prv->sbuf), &work, sizeof(TS_WORK_BUFFER));
+
+	if(r < 1){
+		/* error or need more data */
+		return r;
 	}
 
-	if(prv->program != NULL){
-		for(i=0;i<prv->p_count;i++){
-			release_program(prv, prv->program+i);
+	r = proc_arib_std_b25_inplace(prv, buf, buf+size, &done);
+	*consumed = done - buf;
+
+	return r;
+}
+
+/* pull variant of get() for callers that own the output memory.
+
+   writes whole 188 byte packets into dst, at most cap bytes (188 or
+   more), and sets *written. once called put() stops decrypting ahead, input is kept in
+   sbuf and decrypted here straight into dst, so dbuf does not grow and
+   memory per instance is bounded by what the caller leaves unread.
+   output produced before the first call, and by flush(), is handed out
+   first. call until *written is 0 to drain everything that is ready. */
+static int get_into_arib_std_b25(void *std_b25, uint8_t *dst, int32_t cap, int32_t *written)
+{
+	int r;
+	int n;
+
+	TS_WORK_BUFFER out;
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = private_data(std_b25);
+	if( (prv == NULL) || (dst == NULL) || (cap < 188) || (written == NULL) ){
+		return ARIB_STD_B25_ERROR_INVALID_PARAM;
+	}
+
+	*written = 0;
+	prv->pull = 1;
+
+	n = prv->dbuf.tail - prv->dbuf.head;
+	if(n > 0){
+		if(n > cap){
+			n = cap - (cap % 188);
+		}
+		memcpy(dst, prv->dbuf.head, n);
+		prv->dbuf.head += n;
+		if(prv->dbuf.head == prv->dbuf.tail){
+			reset_work_buffer(&(prv->dbuf));
+		}
+		*written = n;
+		if(prv->dbuf.head != prv->dbuf.tail){
+			return 0;
+		}
+	}
+
+	if(prv->sbuf.head == prv->sbuf.tail){
+		return 0;
+	}
+
+	r = proc_head(prv);
+	if(r < 1){
+		/* error or need more data */
+		return r;
+	}
+
+	out.pool = dst;
+	out.head = dst;
+	out.tail = dst + *written;
+	out.max = cap;
+
+	r = proc_arib_std_b25(prv, &out, 0);
+	*written = out.tail - dst;
+
+	return r;
+}
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ private method implementation
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+static ARIB_STD_B25_PRIVATE_DATA *private_data(void *std_b25)
+{
+	ARIB_STD_B25 *p;
+	ARIB_STD_B25_PRIVATE_DATA *r;
+
+	p = (ARIB_STD_B25 *)std_b25;
+	if(p == NULL){
+		return NULL;
+	}
+
+	r = (ARIB_STD_B25_PRIVATE_DATA *)p->private_data;
+	if( ((void *)(r+1)) != ((void *)p) ){
+		return NULL;
+	}
+
+	return r; 
+}
+
+static void teardown(ARIB_STD_B25_PRIVATE_DATA *prv)
+{
+	int i;
+	
+	prv->unit_size = 0;
+	prv->sbuf_offset = 0;
+
+	if(prv->pat != NULL){
+		prv->pat->release(prv->pat);
+		prv->pat = NULL;
+	}
+	if(prv->cat != NULL){
+		prv->cat->release(prv->cat);
+		prv->cat = NULL;
+	}
+
+	if(prv->program != NULL){
+		for(i=0;i<prv->p_count;i++){
+			release_program(prv, prv->program+i);
 		}
 		free(prv->program);
 		prv->program = NULL;
@@ -988,6 +997,8 @@ static void teardown(ARIB_STD_B25_PRIVATE_DATA *prv)
 	}
 
 	memset(prv->map, 0, sizeof(prv->map));
+	memset(prv->pid_hot, 0, sizeof(prv->pid_hot));
+	memset(prv->stat, 0, sizeof(prv->stat));
 
 	prv->emm_pid = 0;
 	if(prv->emm != NULL){
@@ -999,11 +1010,84 @@ static void teardown(ARIB_STD_B25_PRIVATE_DATA *prv)
 	release_work_buffer(&(prv->dbuf));
 }
 
+static int proc_head(ARIB_STD_B25_PRIVATE_DATA *prv)
+{
+	int n;
+
+	if(prv->unit_size < 188){
+		n = select_unit_size(prv);
+		if(n < 0){
+			return n;
+		}
+		if(prv->unit_size < 188){
+			/* need more data */
+			return 0;
+		}
+	}
+
+	if(prv->p_count < 1){
+		n = find_pat(prv);
+		if(n < 0){
+			return n;
+		}
+		if(prv->p_count < 1){
+			if(prv->sbuf_offset < (16*1024*1024)){
+				/* need more data */
+				return 0;
+			}else{
+				/* exceed sbuf limit */
+				return ARIB_STD_B25_ERROR_NO_PAT_IN_HEAD_16M;
+			}
+		}
+		prv->sbuf_offset = 0;
+	}
+
+	if(!check_pmt_complete(prv)){
+		n = find_pmt(prv);
+		if(n < 0){
+			return n;
+		}
+		if(!check_pmt_complete(prv)){
+			if(prv->sbuf_offset < (32*1024*1024)){
+				/* need more data */
+				return 0;
+			}else{
+				/* exceed sbuf limit */
+				return ARIB_STD_B25_ERROR_NO_PMT_IN_HEAD_32M;
+			}
+		}
+		prv->sbuf_offset = 0;
+	}
+
+	if(!check_ecm_complete(prv)){
+		n = find_ecm(prv);
+		if(n < 0){
+			return n;
+		}
+		if(!check_ecm_complete(prv)){
+			if(prv->sbuf_offset < (32*1024*1024)){
+				/* need more data */
+				return 0;
+			}else{
+				/* exceed sbuf limit */
+				return ARIB_STD_B25_ERROR_NO_ECM_IN_HEAD_32M;
+			}
+		}
+		prv->sbuf_offset = 0;
+	}
+
+
+	return 1;
+}
+
 static int select_unit_size(ARIB_STD_B25_PRIVATE_DATA *prv)
 {
 	int i;
 	int m,n,w;
 	int count[320-188];
+	int32_t pair[3];
+
+	static const int unit_sizes[3] = { 188, 192, 204 };
 
 	unsigned char *head;
 	unsigned char *buf;
@@ -1011,6 +1095,23 @@ static int select_unit_size(ARIB_STD_B25_PRIVATE_DATA *prv)
 
 	head = prv->sbuf.head;
 	tail = prv->sbuf.tail;
+
+	// fast path, count 0x47 pairs at 188/192/204 bytes apart in one pass
+	// and take the best one when it passes the verification below
+	prv->sync->count_pairs(head, tail, pair);
+	m = 0;
+	n = 0;
+	for(i=0;i<3;i++){
+		if(m < pair[i]){
+			m = pair[i];
+			n = unit_sizes[i];
+		}
+	}
+	w = m*n;
+	if( (m >= 8) && ((w+3*n) >= (tail-head)) ){
+		prv->unit_size = n;
+		return 0;
+	}
 	
 	buf = head;
 	memset(count, 0, sizeof(count));
@@ -1074,7 +1175,7 @@ static int find_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 
 	while( (curr+unit) < tail ){
 		if( (curr[0] != 0x47) || (curr[unit] != 0x47) ){
-			p = resync(curr, tail, unit);
+			p = resync(prv->sync, curr, tail, unit);
 			if(p == NULL){
 				goto LAST;
 			}
@@ -1093,25 +1194,15 @@ static int find_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 			}
 			
 			if(prv->pat == NULL){
-				prv->pat = create_ts_section_parser();
+				prv->pat = create_section_parser(prv, on_pat_section);
 				if(prv->pat == NULL){
 					return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 				}
 			}
 			
-			n = prv->pat->put(prv->pat, &hdr, p, size);
-			if(n < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-				curr += unit;
-				goto LAST;
-			}
-			n = prv->pat->get_count(prv->pat);
-			if(n < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-				curr += unit;
-				goto LAST;
-			}
-			if(n > 0){
+			n = put_section(prv, prv->pat, NULL, &hdr, p, size, ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE);
+			if( (n < 0) || (prv->sect_count > 0) ){
+				r = n;
 				curr += unit;
 				goto LAST;
 			}
@@ -1123,17 +1214,13 @@ static int find_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 LAST:
 	prv->sbuf_offset = curr - prv->sbuf.head;
 
-	if( (prv->pat != NULL) && (prv->pat->get_count(prv->pat) > 0) ){
-		r = proc_pat(prv);
-	}
-
 	return r;
 }
 
-static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
+static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect)
 {
 	int r;
-	int i,n;
+	int i;
 	int len;
 	int count;
 	
@@ -1144,23 +1231,15 @@ static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 	uint8_t *tail;
 	
 	TS_PROGRAM *work;
-	TS_SECTION  sect;
 
 	r = 0;
-	memset(&sect, 0, sizeof(sect));
-
-	n = prv->pat->get(prv->pat, &sect);
-	if(n < 0){
-		r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-		goto LAST;
-	}
 
-	if(sect.hdr.table_id != TS_SECTION_ID_PROGRAM_ASSOCIATION){
+	if(sect->hdr.table_id != TS_SECTION_ID_PROGRAM_ASSOCIATION){
 		r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
 		goto LAST;
 	}
 
-	len = (sect.tail - sect.data) - 4;
+	len = (sect->tail - sect->data) - 4;
 
 	count = len / 4;
 	work = (TS_PROGRAM *)calloc(count, sizeof(TS_PROGRAM));
@@ -1179,8 +1258,8 @@ static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 	prv->p_count = 0;
 	memset(&(prv->map), 0, sizeof(prv->map));
 
-	head = sect.data;
-	tail = sect.tail-4;
+	head = sect->data;
+	tail = sect->tail-4;
 
 	i = 0;
 	while( (head+4) <= tail ){
@@ -1189,13 +1268,14 @@ static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 		if(program_number != 0){
 			work[i].program_number = program_number;
 			work[i].pmt_pid = pid;
-			work[i].pmt = create_ts_section_parser();
+			work[i].pmt = create_section_parser(prv, on_pmt_section);
 			if(work[i].pmt == NULL){
 				r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 				break;
 			}
 			prv->map[pid].type = PID_MAP_TYPE_PMT;
 			prv->map[pid].target = work+i;
+			update_pid_hot(prv, pid);
 			i += 1;
 		}
 		head += 4;
@@ -1207,15 +1287,9 @@ static int proc_pat(ARIB_STD_B25_PRIVATE_DATA *prv)
 	prv->map[0x0000].ref = 1;
 	prv->map[0x0000].type = PID_MAP_TYPE_PAT;
 	prv->map[0x0000].target = NULL;
+	update_pid_hot(prv, 0x0000);
 
 LAST:
-	if(sect.raw != NULL){
-		n = prv->pat->ret(prv->pat, &sect);
-		if( (n < 0) && (r == 0) ){
-			r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-		}
-	}
-
 	return r;
 }
 
@@ -1269,7 +1343,7 @@ static int find_pmt(ARIB_STD_B25_PRIVATE_DATA *prv)
 	while( (curr+unit) < tail ){
 		
 		if( (curr[0] != 0x47) || (curr[unit] != 0x47) ){
-			p = resync(curr, tail, unit);
+			p = resync(prv->sync, curr, tail, unit);
 			if(p == NULL){
 				goto LAST;
 			}
@@ -1304,26 +1378,16 @@ static int find_pmt(ARIB_STD_B25_PRIVATE_DATA *prv)
 				goto LAST;
 			}
 			
-			n = pgrm->pmt->put(pgrm->pmt, &hdr, p, size);
-			if(n < 0){
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				curr += unit;
-				goto LAST;
-			}
-			n = pgrm->pmt->get_count(pgrm->pmt);
+			n = put_section(prv, pgrm->pmt, pgrm, &hdr, p, size, ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE);
 			if(n < 0){
-				r =ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
+				r = n;
 				curr += unit;
 				goto LAST;
 			}
-			if(n == 0){
+			if(prv->sect_count == 0){
 				goto NEXT;
 			}
-			r = proc_pmt(prv, pgrm);
-			if(r < 0){
-				curr += unit;
-				goto LAST;
-			}
+			r = n;
 			if(r > 0){
 				/* broken or unexpected section data */
 				goto NEXT;
@@ -1349,11 +1413,10 @@ LAST:
 	return r;
 }
 
-static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm)
+static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm, TS_SECTION *sect)
 {
 	int r;
 
-	int n;
 	int length;
 
 	uint8_t *head;
@@ -1363,8 +1426,6 @@ static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm)
 	int32_t pid;
 	int32_t type;
 
-	TS_SECTION sect;
-	
 	DECRYPTOR_ELEM *dec[2];
 	DECRYPTOR_ELEM *dw;
 	
@@ -1373,20 +1434,14 @@ static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm)
 
 	r = 0;
 	dec[0] = NULL;
-	memset(&sect, 0, sizeof(sect));
 
-	n = pgrm->pmt->get(pgrm->pmt, &sect);
-	if(n < 0){
-		r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-		goto LAST;
-	}
-	if(sect.hdr.table_id != TS_SECTION_ID_PROGRAM_MAP){
+	if(sect->hdr.table_id != TS_SECTION_ID_PROGRAM_MAP){
 		r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
 		goto LAST;
 	}
 	
-	head = sect.data;
-	tail = sect.tail-4;
+	head = sect->data;
+	tail = sect->tail-4;
 
 	pgrm->pcr_pid = ((head[0] << 8) | head[1]) & 0x1fff;
 	length = ((head[2] << 8) | head[3]) & 0x0fff;
@@ -1475,6 +1530,7 @@ static int proc_pmt(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm)
 
 		dw = select_active_decryptor(dec[0], dec[1], ecm_pid);
 		bind_stream_decryptor(prv, pid, dw);
+		update_pid_hot(prv, pid);
 		
 		put_stream_list_tail(&(pgrm->streams), strm);
 	}
@@ -1488,13 +1544,6 @@ LAST:
 		}
 	}
 
-	if(sect.raw != NULL){
-		n = pgrm->pmt->ret(pgrm->pmt, &sect);
-		if( (n < 0) && (r == 0) ){
-			return ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-		}
-	}
-
 	return r;
 }
 		
@@ -1603,7 +1652,7 @@ static int find_ecm(ARIB_STD_B25_PRIVATE_DATA *prv)
 
 	while( (curr+unit) < tail ){
 		if( (curr[0] != 0x47) || (curr[unit] != 0x47) ){
-			p = resync(curr, tail, unit);
+			p = resync(prv->sync, curr, tail, unit);
 			if(p == NULL){
 				goto LAST;
 			}
@@ -1636,27 +1685,17 @@ static int find_ecm(ARIB_STD_B25_PRIVATE_DATA *prv)
 				goto LAST;
 			}
 				
-			n = dec->ecm->put(dec->ecm, &hdr, p, size);
-			if(n < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				curr += unit;
-				goto LAST;
-			}
-			n = dec->ecm->get_count(dec->ecm);
+			n = put_section(prv, dec->ecm, dec, &hdr, p, size, ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE);
 			if(n < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
+				r = n;
 				curr += unit;
 				goto LAST;
 			}
-			if(n == 0){
+			if(prv->sect_count == 0){
 				goto NEXT;
 			}
 
-			r = proc_ecm(dec, prv->bcas, prv->multi2_round);
-			if(r < 0){
-				curr += unit;
-				goto LAST;
-			}
+			r = n;
 			if( (r > 0) && (r != ARIB_STD_B25_WARN_UNPURCHASED_ECM) ){
 				/* broken or unexpected section data */
 				goto NEXT;
@@ -1684,9 +1723,9 @@ LAST:
 	return r;
 }
 
-static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round)
+static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round, TS_SECTION *sect)
 {
-	int r,n;
+	int r;
 	int length;
 
 	uint8_t *p;
@@ -1694,22 +1733,14 @@ static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round)
 	B_CAS_INIT_STATUS is;
 	B_CAS_ECM_RESULT res;
 
-	TS_SECTION sect;
-
 	r = 0;
-	memset(&sect, 0, sizeof(sect));
 
 	if(bcas == NULL){
 		r = ARIB_STD_B25_ERROR_EMPTY_B_CAS_CARD;
 		goto LAST;
 	}
 
-	n = dec->ecm->get(dec->ecm, &sect);
-	if(n < 0){
-		r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-		goto LAST;
-	}
-	if(sect.hdr.table_id != TS_SECTION_ID_ECM_S){
+	if(sect->hdr.table_id != TS_SECTION_ID_ECM_S){
 		r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
 		goto LAST;
 	}
@@ -1722,8 +1753,8 @@ static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round)
 		goto LAST;
 	}
 
-	length = (sect.tail - sect.data) - 4;
-	p = sect.data;
+	length = (sect->tail - sect->data) - 4;
+	p = sect->data;
 
 	r = bcas->proc_ecm(bcas, &res, p, length);
 	if(r < 0){
@@ -1764,6 +1795,7 @@ static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round)
 	}
 
 	dec->m2->set_scramble_key(dec->m2, res.scramble_key);
+	rekey_multi2(&dec->m2, 1); /* odd and even work keys in one pass */
 
 #if defined(DEBUG)
 	int i;
@@ -1782,13 +1814,6 @@ static int proc_ecm(DECRYPTOR_ELEM *dec, B_CAS_CARD *bcas, int32_t multi2_round)
 #endif
 	
 LAST:
-	if(sect.raw != NULL){
-		n = dec->ecm->ret(dec->ecm, &sect);
-		if( (n < 0) && (r == 0) ){
-			r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-		}
-	}
-	
 	return r;
 }
 
@@ -1830,278 +1855,623 @@ static void dump_pts(uint8_t *src, int32_t crypt)
 }
 #endif
 
-static int proc_arib_std_b25(ARIB_STD_B25_PRIVATE_DATA *prv)
+/* decrypts sbuf into dst, which is reserved up front when grow is set
+   and otherwise only filled while a whole packet still fits.
+
+   packets are decrypted where they lie in sbuf and copied out as spans
+   of adjacent packets, so with 188 byte units and no stripping a whole
+   call costs one copy. when dst is dbuf and still empty that copy is
+   skipped too, dbuf takes over the sbuf pool and only the unprocessed
+   remainder moves to the old dbuf pool */
+static int proc_arib_std_b25(ARIB_STD_B25_PRIVATE_DATA *prv, TS_WORK_BUFFER *dst, int32_t grow)
 {
 	int r;
-	int m,n;
+	int i,m,n;
 
-	int32_t crypt;
-	int32_t unit;
-	int32_t pid;
+	int32_t max;
+	int32_t end;
+	int32_t action;
 
 	uint8_t *p;
 	uint8_t *curr;
 	uint8_t *tail;
 
-	TS_HEADER hdr;
-	DECRYPTOR_ELEM *dec;
-	TS_PROGRAM *pgrm;
+	uint8_t *span_head;
+	uint8_t *span_tail;
 
-	unit = prv->unit_size;
 	curr = prv->sbuf.head;
 	tail = prv->sbuf.tail;
 
-	m = prv->dbuf.tail - prv->dbuf.head;
-	n = tail - curr;
-	if(!reserve_work_buffer(&(prv->dbuf), m+n)){
-		return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+	span_head = curr;
+	span_tail = curr;
+
+	if(grow){
+		m = dst->tail - dst->head;
+		n = tail - curr;
+		if(!reserve_work_buffer(dst, m+n)){
+			return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+		}
 	}
 
 	r = 0;
 
-	while( (curr+unit) < tail ){
-		
-		if( (curr[0] != 0x47) || (curr[unit] != 0x47) ){
-			p = resync(curr, tail, unit);
-			if(p == NULL){
+	end = PACKET_BATCH_FULL;
+	while(end != PACKET_BATCH_INPUT){
+
+		max = PACKET_BATCH_MAX;
+		if(!grow){
+			/* only as many packets as still fit */
+			m = (((dst->pool + dst->max) - dst->tail) - (span_tail - span_head)) / 188;
+			if(m < 1){
 				goto LAST;
 			}
-			curr = p;
+			if(m < max){
+				max = m;
+			}
+		}
+
+		end = collect_packets(prv, &curr, tail, PACKET_SCAN_STREAM, max);
+
+		m = decrypt_packets(prv);
+		if(m < 0){
+			r = m;
+			curr = prv->batch.packet[0];
+			goto LAST;
 		}
-		
-		extract_ts_header(&hdr, curr);
-		crypt = hdr.transport_scrambling_control;
-		pid = hdr.pid;
 
-		if(hdr.transport_error_indicator != 0){
-			/* bit error - append output buffer without parsing */
-			if(!append_work_buffer(&(prv->dbuf), curr, 188)){
+		for(i=0;i<prv->batch.count;i++){
+			if(!append_span(dst, &span_head, &span_tail, prv->batch.packet[i])){
 				r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+				curr = prv->batch.packet[i];
 				goto LAST;
 			}
-			goto NEXT;
-		}
-		
-		if( (pid == 0x1fff) && (prv->strip) ){
-			/* strip null(padding) stream */
-			goto NEXT;
-		}
-
-		p = curr+4;
-		if(hdr.adaptation_field_control & 0x02){
-			p += (p[0]+1);
-		}
-		n = 188 - (p-curr);
-		if( (n < 1) && ((n < 0) || (hdr.adaptation_field_control & 0x01)) ){
-			/* broken packet */
-			curr += 1;
-			continue;
 		}
 
-		if( (crypt != 0) &&
-		    (hdr.adaptation_field_control & 0x01) ){
-			
-			if(prv->map[pid].type == PID_MAP_TYPE_OTHER){
-				dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
-			}else if( (prv->map[pid].type == 0) &&
-			          (prv->decrypt.count == 1) ){
-				dec = prv->decrypt.head;
-			}else{
-				dec = NULL;
+		if(end == PACKET_BATCH_SECTION){
+			m = route_section(prv, &action);
+			if(m < 0){
+				/* retried from this packet on the next call */
+				r = m;
+				curr = prv->batch.packet[prv->batch.count-1];
+				goto LAST;
 			}
-
-			if( (dec != NULL) && (dec->m2 != NULL) ){
-				m = dec->m2->decrypt(dec->m2, crypt, p, n);
-				if(m < 0){
-					r = ARIB_STD_B25_ERROR_DECRYPT_FAILURE;
-					goto LAST;
-				}
-				curr[3] &= 0x3f;
-				prv->map[pid].normal_packet += 1;
-			}else{
-				prv->map[pid].undecrypted += 1;
+			if(m > 0){
+				r = m;
+			}
+			if(action == PACKET_PAT){
+				/* back to the head of stream scan, which starts with this
+				   packet again */
+				curr = prv->batch.packet[prv->batch.count-1];
+				goto LAST;
 			}
-		}else{
-			prv->map[pid].normal_packet += 1;
-		}
-#if defined(DEBUG)
-		if( (hdr.payload_unit_start_indicator != 0) && (pid == 0x111) ){
-			dump_pts(curr, crypt);
 		}
-#endif
-		if(!append_work_buffer(&(prv->dbuf), curr, 188)){
-			r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-			goto LAST;
+	}
+
+LAST:
+	n = tail - curr;
+	if( grow && (dst == &(prv->dbuf)) && (dst->head == dst->tail) && (span_head < span_tail) ){
+		/* dbuf was reserved for all of sbuf above, so the remainder fits */
+		p = dst->pool;
+		m = dst->max;
+		dst->pool = prv->sbuf.pool;
+		dst->head = span_head;
+		dst->tail = span_tail;
+		dst->max = prv->sbuf.max;
+		memcpy(p, curr, n);
+		prv->sbuf.pool = p;
+		prv->sbuf.head = p;
+		prv->sbuf.tail = p+n;
+		prv->sbuf.max = m;
+		return r;
+	}
+	if(!append_work_buffer(dst, span_head, span_tail-span_head)){
+		r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
+	}
+
+	consume_work_buffer(&(prv->sbuf), curr);
+
+	return r;
+}
+
+static int proc_arib_std_b25_inplace(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t *head, uint8_t *tail, uint8_t **done)
+{
+	int r;
+	int m;
+
+	int32_t end;
+	int32_t action;
+
+	uint8_t *curr;
+
+	curr = head;
+
+	r = 0;
+
+	/* null packets are kept, there is nowhere to close the gap */
+	end = PACKET_BATCH_FULL;
+	while(end != PACKET_BATCH_INPUT){
+
+		end = collect_packets(prv, &curr, tail, PACKET_SCAN_INPLACE, PACKET_BATCH_MAX);
+
+		m = decrypt_packets(prv);
+		if(m < 0){
+			r = m;
+			curr = prv->batch.packet[0];
+			goto LAST;
 		}
 
-		if(prv->map[pid].type == PID_MAP_TYPE_ECM){
-			dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
-			if( (dec == NULL) || (dec->ecm == NULL) ){
-				/* this code will never execute */
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = dec->ecm->put(dec->ecm, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = dec->ecm->get_count(dec->ecm);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_ecm(dec, prv->bcas, prv->multi2_round);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(prv->map[pid].type == PID_MAP_TYPE_PMT){
-			pgrm = (TS_PROGRAM *)(prv->map[pid].target);
-			if( (pgrm == NULL) || (pgrm->pmt == NULL) ){
-				/* this code will never execute */
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = pgrm->pmt->put(pgrm->pmt, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = pgrm->pmt->get_count(pgrm->pmt);
+		if(end == PACKET_BATCH_SECTION){
+			m = route_section(prv, &action);
 			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
+				r = m;
 				goto LAST;
 			}
-			if(m == 0){
-				goto NEXT;
+			if(m > 0){
+				r = m;
 			}
-			r = proc_pmt(prv, pgrm);
-			if(r < 0){
+			if( (action == PACKET_PAT) && !check_pmt_complete(prv) ){
+				/* new PAT - the caller goes back to the head of stream scan */
 				goto LAST;
 			}
-		}else if(prv->map[pid].type == PID_MAP_TYPE_EMM){
-			if( prv->emm_proc_on == 0){
-				goto NEXT;
+		}
+	}
+
+LAST:
+	*done = curr;
+
+	return r;
+}
+
+/* 1st pass of the decode pipeline for a single packet, whose header is
+   entry i of prv->batch.hdr. counts it and, unless it is dropped, adds
+   it to prv->batch with its payload and the decryptor it needs, if any.
+   returns a PACKET_* action */
+static PACKET_INLINE int classify_packet(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t *curr, int32_t i, int32_t strip)
+{
+	int n;
+
+	int32_t crypt;
+	int32_t afc;
+	int32_t pid;
+	int32_t hot;
+
+	DECRYPTOR_ELEM *dec;
+	PACKET_BATCH *batch;
+
+	batch = &(prv->batch);
+
+	crypt = batch->hdr.scrambling[i];
+	afc = batch->hdr.adaptation[i];
+	pid = batch->hdr.pid[i];
+
+	batch->packet[batch->count] = curr;
+	batch->dec[batch->count] = NULL;
+
+	if(batch->hdr.error[i] != 0){
+		/* bit error - pass it without parsing */
+		batch->count += 1;
+		return PACKET_PASS;
+	}
+
+	if( (pid == 0x1fff) && (strip) ){
+		/* strip null(padding) stream */
+		return PACKET_DROP;
+	}
+
+	n = 184;
+	if(afc & 0x02){
+		n -= (batch->hdr.adaptation_length[i]+1);
+	}
+	if( (n < 1) && ((n < 0) || (afc & 0x01)) ){
+		/* broken packet */
+		return PACKET_BROKEN;
+	}
+
+	batch->payload[batch->count] = curr + (188-n);
+	batch->size[batch->count] = n;
+
+	hot = prv->pid_hot[pid];
+
+	if( (crypt != 0) &&
+	    (afc & 0x01) ){
+
+		if( (hot != PID_HOT_UNKNOWN) && (hot <= PID_HOT_SLOT_MAX) ){
+			dec = prv->dec_slot[hot];
+		}else if(hot == PID_HOT_STREAM){
+			dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
+		}else if( (hot == PID_HOT_UNKNOWN) &&
+		          (prv->decrypt.count == 1) ){
+			dec = prv->decrypt.head;
+		}else{
+			dec = NULL;
+		}
+
+		if( (dec != NULL) && (dec->m2 != NULL) ){
+			batch->dec[batch->count] = dec;
+			batch->type[batch->count] = crypt;
+			prv->stat[pid].normal_packet += 1;
+		}else{
+			prv->stat[pid].undecrypted += 1;
+		}
+	}else{
+		prv->stat[pid].normal_packet += 1;
+	}
+#if defined(DEBUG)
+	if( (batch->hdr.unit_start[i] != 0) && (pid == 0x111) ){
+		dump_pts(curr, crypt);
+	}
+#endif
+
+	batch->count += 1;
+
+	if( (hot != PID_HOT_UNKNOWN) && (hot != PID_HOT_SECTION) ){
+		/* elementary stream, the common case ends here */
+		return PACKET_PASS;
+	}
+
+	get_ts_header_soa(&(batch->hdr), i, &(batch->section));
+
+	return PACKET_SECTION;
+}
+
+/* number of packets, up to max, that follow the one at curr back to
+   back and pass the sync check of scan. the one at curr already did */
+static int32_t packet_run(uint8_t *curr, uint8_t *tail, int32_t unit, int32_t scan, int32_t max)
+{
+	int32_t n;
+
+	uint8_t *p;
+
+	n = 1;
+	p = curr + unit;
+
+	if(scan == PACKET_SCAN_STREAM){
+		while( (n < max) && ((p+unit) < tail) && (p[unit] == 0x47) ){
+			n += 1;
+			p += unit;
+		}
+	}else if(scan == PACKET_SCAN_INPLACE){
+		while( (n < max) && ((p+unit) <= tail) && (p[0] == 0x47) &&
+		       ( ((p+unit) == tail) || (p[unit] == 0x47) ) ){
+			n += 1;
+			p += unit;
+		}
+	}else{
+		while( (n < max) && ((p+188) <= tail) && (p[0] == 0x47) ){
+			n += 1;
+			p += unit;
+		}
+	}
+
+	return n;
+}
+
+/* 1st pass of the decode pipeline. classifies the packets from *curr on
+   into prv->batch until max are taken, a PSI/ECM/EMM packet is taken -
+   its section may change the keys of the packets after it - or the input
+   runs out. *curr is left after the last packet looked at. returns a
+   PACKET_BATCH_* reason */
+static int collect_packets(ARIB_STD_B25_PRIVATE_DATA *prv, uint8_t **curr, uint8_t *tail, int32_t scan, int32_t max)
+{
+	int32_t unit;
+	int32_t strip;
+	int32_t action;
+	int32_t i,n;
+
+	uint8_t *p;
+	uint8_t *c;
+
+	unit = prv->unit_size;
+	strip = (scan == PACKET_SCAN_INPLACE) ? 0 : prv->strip;
+	c = *curr;
+
+	prv->batch.count = 0;
+
+	i = 0;
+	n = 0;
+
+	while(prv->batch.count < max){
+
+		if(i < n){
+			/* next packet of the current run, already checked */
+		}else if(scan == PACKET_SCAN_STREAM){
+			if( (c+unit) >= tail ){
+				goto INPUT;
 			}
-			if( prv->emm == NULL ){
-				prv->emm = create_ts_section_parser();
-				if(prv->emm == NULL){
-					r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-					goto LAST;
+			if( (c[0] != 0x47) || (c[unit] != 0x47) ){
+				p = resync(prv->sync, c, tail, unit);
+				if(p == NULL){
+					goto INPUT;
 				}
-			}
-			m = prv->emm->put(prv->emm, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-				goto LAST;
-			}
-			m = prv->emm->get_count(prv->emm);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-				goto LAST;
-			}
-			if(m == 0){
-				goto NEXT;
-			}
-			r = proc_emm(prv);
-			if(r < 0){
-				goto LAST;
-			}
-		}else if(pid == 0x0001){
-			if( prv->cat == NULL ){
-				prv->cat = create_ts_section_parser();
-				if(prv->cat == NULL){
-					r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-					goto LAST;
+				c = p;
+			}
+		}else if(scan == PACKET_SCAN_INPLACE){
+			if( (c+unit) > tail ){
+				goto INPUT;
+			}
+			if( (c[0] != 0x47) ||
+			    ( ((c+unit) < tail) && (c[unit] != 0x47) ) ){
+				p = resync(prv->sync, c, tail, unit);
+				if(p == NULL){
+					/* no packet run starts before the last 8 units */
+					if( (tail-c) > (unit*8) ){
+						c = tail - unit*8 + 1;
+					}
+					goto INPUT;
 				}
+				c = p;
 			}
-			m = prv->cat->put(prv->cat, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-				goto LAST;
+		}else{
+			if( (c+188) > tail ){
+				goto INPUT;
 			}
-			m = prv->cat->get_count(prv->cat);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-				goto LAST;
+			if(c[0] != 0x47){
+				p = resync_force(prv->sync, c, tail, unit);
+				if(p == NULL){
+					goto INPUT;
+				}
+				c = p;
 			}
-			if(m == 0){
-				goto NEXT;
+		}
+
+		if(i >= n){
+			/* unpack the headers of the whole run at once */
+			n = TS_HEADER_SOA_MAX;
+			if( (max - prv->batch.count) < n ){
+				n = max - prv->batch.count;
 			}
-			r = proc_cat(prv);
-			if(r < 0){
-				goto LAST;
+			n = packet_run(c, tail, unit, scan, n);
+			prv->hdr->extract(c, unit, n, &(prv->batch.hdr));
+			i = 0;
+		}
+
+		action = classify_packet(prv, c, i, strip);
+		i += 1;
+		if(action == PACKET_BROKEN){
+			/* the rest of the run is not aligned to this one */
+			n = 0;
+			c += 1;
+			continue;
+		}
+		c += unit;
+		if(action == PACKET_SECTION){
+			*curr = c;
+			return PACKET_BATCH_SECTION;
+		}
+	}
+
+	*curr = c;
+	return PACKET_BATCH_FULL;
+
+INPUT:
+	*curr = c;
+	return PACKET_BATCH_INPUT;
+}
+
+/* 2nd pass of the decode pipeline. every decryptor gets its packets in
+   one MULTI2::decrypt_batch() call, which splits them further into runs
+   of one key parity */
+static int decrypt_packets(ARIB_STD_B25_PRIVATE_DATA *prv)
+{
+	int i,j,m,n;
+
+	DECRYPTOR_ELEM *dec;
+	PACKET_BATCH *batch;
+
+	batch = &(prv->batch);
+
+	for(i=0;i<batch->count;i++){
+
+		dec = batch->dec[i];
+		if(dec == NULL){
+			continue;
+		}
+
+		n = 0;
+		for(j=i;j<batch->count;j++){
+			if(batch->dec[j] != dec){
+				continue;
 			}
-		}else if(pid == 0x0000){
-			if( prv->pat == NULL ){
-				prv->pat = create_ts_section_parser();
-				if(prv->pat == NULL){
-					r = ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
-					goto LAST;
-				}
+			batch->buf[n] = batch->payload[j];
+			batch->len[n] = batch->size[j];
+			batch->parity[n] = batch->type[j];
+			n += 1;
+		}
+
+		m = dec->m2->decrypt_batch(dec->m2, batch->parity, batch->buf, batch->len, n);
+		if(m < 0){
+			return ARIB_STD_B25_ERROR_DECRYPT_FAILURE;
+		}
+
+		for(j=i;j<batch->count;j++){
+			if(batch->dec[j] != dec){
+				continue;
 			}
-			m = prv->pat->put(prv->pat, &hdr, p, n);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-				goto LAST;
+			batch->packet[j][3] &= 0x3f;
+			batch->dec[j] = NULL;
+		}
+	}
+
+	return 0;
+}
+
+/* 3rd pass of the decode pipeline, for the PSI/ECM/EMM packet that ended
+   the batch. returns an error or the warning of a completed section */
+static int route_section(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t *action)
+{
+	int32_t last;
+
+	last = prv->batch.count - 1;
+	*action = PACKET_PASS;
+
+	return proc_section_packet(prv, &(prv->batch.section), prv->batch.payload[last], prv->batch.size[last], action);
+}
+
+/* feeds a PSI/ECM/EMM packet to its section parser and handles completed sections */
+static int proc_section_packet(ARIB_STD_B25_PRIVATE_DATA *prv, TS_HEADER *hdr, uint8_t *p, int32_t n, int32_t *action)
+{
+	int m;
+	int32_t pid;
+
+	DECRYPTOR_ELEM *dec;
+	TS_PROGRAM *pgrm;
+
+	pid = hdr->pid;
+
+	switch(prv->map[pid].type){
+	case PID_MAP_TYPE_ECM:
+		dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
+		if( (dec == NULL) || (dec->ecm == NULL) ){
+			/* this code will never execute */
+			return ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE;
+		}
+		return put_section(prv, dec->ecm, dec, hdr, p, n, ARIB_STD_B25_ERROR_ECM_PARSE_FAILURE);
+	case PID_MAP_TYPE_PMT:
+		pgrm = (TS_PROGRAM *)(prv->map[pid].target);
+		if( (pgrm == NULL) || (pgrm->pmt == NULL) ){
+			/* this code will never execute */
+			return ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE;
+		}
+		return put_section(prv, pgrm->pmt, pgrm, hdr, p, n, ARIB_STD_B25_ERROR_PMT_PARSE_FAILURE);
+	case PID_MAP_TYPE_EMM:
+		if( prv->emm_proc_on == 0){
+			return 0;
+		}
+		if( prv->emm == NULL ){
+			prv->emm = create_section_parser(prv, on_emm_section);
+			if(prv->emm == NULL){
+				return ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
 			}
-			m = prv->pat->get_count(prv->pat);
-			if(m < 0){
-				r = ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE;
-				goto LAST;
+		}
+		return put_section(prv, prv->emm, NULL, hdr, p, n, ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE);
+	}
+
+	/* PAT and CAT go by PID, their map entries are typed only once parsed */
+	if(pid == 0x0001){
+		if( prv->cat == NULL ){
+			prv->cat = create_section_parser(prv, on_cat_section);
+			if(prv->cat == NULL){
+				return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 			}
-			if(m == 0){
-				goto NEXT;
+		}
+		return put_section(prv, prv->cat, NULL, hdr, p, n, ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE);
+	}else if(pid == 0x0000){
+		if( prv->pat == NULL ){
+			prv->pat = create_section_parser(prv, on_pat_section);
+			if(prv->pat == NULL){
+				return ARIB_STD_B25_ERROR_NO_ENOUGH_MEMORY;
 			}
-			r = proc_pat(prv);
-			goto LAST;
 		}
-			
-	NEXT:
-		curr += unit;
+		m = put_section(prv, prv->pat, NULL, hdr, p, n, ARIB_STD_B25_ERROR_PAT_PARSE_FAILURE);
+		if( (m >= 0) && (prv->sect_count > 0) ){
+			*action = PACKET_PAT;
+		}
+		return m;
 	}
 
-LAST:
-	m = curr - prv->sbuf.head;
-	n = tail - curr;
-	if( (n < 1024) || (m > (prv->sbuf.max/2) ) ){
-		p = prv->sbuf.pool;
-		memcpy(p, curr, n);
-		prv->sbuf.head = p;
-		prv->sbuf.tail = p+n;
-	}else{
-		prv->sbuf.head = curr;
+	return 0;
+}
+
+/* every section parser of the decoder runs in callback mode - sections are
+   handed to proc_pat() and the rest as soon as they pass the crc check,
+   and never queued for get() */
+static TS_SECTION_PARSER *create_section_parser(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION_CALLBACK callback)
+{
+	TS_SECTION_PARSER *r;
+
+	r = create_ts_section_parser_with_slab(prv->slab);
+	if(r == NULL){
+		return NULL;
 	}
 
+	r->set_callback(r, callback, prv);
+
 	return r;
 }
 
-static int proc_cat(ARIB_STD_B25_PRIVATE_DATA *prv)
+/* puts one packet of section data, target is what the callback works on.
+   sect_count tells how many sections were consumed, the return value is
+   the last consumer warning or error, or error if the parser failed */
+static int put_section(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION_PARSER *parser, void *target, TS_HEADER *hdr, uint8_t *p, int32_t n, int error)
 {
-	int r;
-	int n;
-	int emm_pid;
+	int m;
 
-	TS_SECTION sect;
+	prv->sect_target = target;
+	prv->sect_count = 0;
+	prv->sect_result = 0;
 
-	r = 0;
-	memset(&sect, 0, sizeof(sect));
+	m = parser->put(parser, hdr, p, n);
+	if( (m < 0) && (prv->sect_result >= 0) ){
+		return error;
+	}
 
-	n = prv->cat->get(prv->cat, &sect);
-	if(n < 0){
-		r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-		goto LAST;
+	return prv->sect_result;
+}
+
+/* only errors stop the parser, warnings are kept for put_section() */
+static int count_section(ARIB_STD_B25_PRIVATE_DATA *prv, int r)
+{
+	prv->sect_count += 1;
+	if(r != 0){
+		prv->sect_result = r;
 	}
 
-	if(sect.hdr.table_id != TS_SECTION_ID_CONDITIONAL_ACCESS){
+	return (r < 0) ? r : 0;
+}
+
+static int on_pat_section(void *ctx, TS_SECTION *sect)
+{
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = (ARIB_STD_B25_PRIVATE_DATA *)ctx;
+	return count_section(prv, proc_pat(prv, sect));
+}
+
+static int on_pmt_section(void *ctx, TS_SECTION *sect)
+{
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = (ARIB_STD_B25_PRIVATE_DATA *)ctx;
+	return count_section(prv, proc_pmt(prv, (TS_PROGRAM *)(prv->sect_target), sect));
+}
+
+static int on_ecm_section(void *ctx, TS_SECTION *sect)
+{
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = (ARIB_STD_B25_PRIVATE_DATA *)ctx;
+	return count_section(prv, proc_ecm((DECRYPTOR_ELEM *)(prv->sect_target), prv->bcas, prv->multi2_round, sect));
+}
+
+static int on_cat_section(void *ctx, TS_SECTION *sect)
+{
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = (ARIB_STD_B25_PRIVATE_DATA *)ctx;
+	return count_section(prv, proc_cat(prv, sect));
+}
+
+static int on_emm_section(void *ctx, TS_SECTION *sect)
+{
+	ARIB_STD_B25_PRIVATE_DATA *prv;
+
+	prv = (ARIB_STD_B25_PRIVATE_DATA *)ctx;
+	return count_section(prv, proc_emm(prv, sect));
+}
+
+static int proc_cat(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect)
+{
+	int r;
+	int emm_pid;
+
+	r = 0;
+
+	if(sect->hdr.table_id != TS_SECTION_ID_CONDITIONAL_ACCESS){
 		r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
 		goto LAST;
 	}
 
-	emm_pid = find_ca_descriptor_pid(sect.data, sect.tail-4, prv->ca_system_id);
+	emm_pid = find_ca_descriptor_pid(sect->data, sect->tail-4, prv->ca_system_id);
 	if( (emm_pid != 0x0000) && (emm_pid != 0x1fff) ){
 		if( (prv->map[emm_pid].target != NULL) &&
 		    (prv->map[emm_pid].type == PID_MAP_TYPE_OTHER) ){
@@ -2116,25 +2486,19 @@ static int proc_cat(ARIB_STD_B25_PRIVATE_DATA *prv)
 		prv->map[emm_pid].ref = 1;
 		prv->map[emm_pid].type = PID_MAP_TYPE_EMM;
 		prv->map[emm_pid].target = NULL;
+		update_pid_hot(prv, emm_pid);
 	}
 	
 	prv->map[0x0001].ref = 1;
 	prv->map[0x0001].type = PID_MAP_TYPE_CAT;
 	prv->map[0x0001].target = NULL;
+	update_pid_hot(prv, 0x0001);
 
 LAST:
-
-	if(sect.raw != NULL){
-		n = prv->cat->ret(prv->cat, &sect);
-		if( (n < 0) && (r == 0) ){
-			r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-		}
-	}
-
 	return r;
 }
 
-static int proc_emm(ARIB_STD_B25_PRIVATE_DATA *prv)
+static int proc_emm(ARIB_STD_B25_PRIVATE_DATA *prv, TS_SECTION *sect)
 {
 	int r;
 	int j,n;
@@ -2144,78 +2508,50 @@ static int proc_emm(ARIB_STD_B25_PRIVATE_DATA *prv)
 	uint8_t *head;
 	uint8_t *tail;
 
-	TS_SECTION sect;
 	EMM_FIXED_PART emm_hdr;
 
 	r = 0;
-	memset(&sect, 0, sizeof(sect));
 
 	if(prv->bcas == NULL){
 		r = ARIB_STD_B25_ERROR_EMPTY_B_CAS_CARD;
 		goto LAST;
 	}
 
-	while( (n = prv->emm->get_count(prv->emm)) > 0 ){
+	if(sect->hdr.table_id == TS_SECTION_ID_EMM_MESSAGE){
+		/* EMM_MESSAGE is not supported */
+		goto LAST;
+	}else if(sect->hdr.table_id != TS_SECTION_ID_EMM_S){
+		r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
+		goto LAST;
+	}
 
-		n = prv->emm->get(prv->emm, &sect);
-		if(n < 0){
-			r = ARIB_STD_B25_ERROR_CAT_PARSE_FAILURE;
-			goto LAST;
-		}
+	head = sect->data;
+	tail = sect->tail - 4;
 
-		if(sect.hdr.table_id == TS_SECTION_ID_EMM_MESSAGE){
-			/* EMM_MESSAGE is not supported */
-			goto NEXT;
-		}else if(sect.hdr.table_id != TS_SECTION_ID_EMM_S){
-			r = ARIB_STD_B25_WARN_TS_SECTION_ID_MISSMATCH;
+	while( (head+13) <= tail ){
+		
+		extract_emm_fixed_part(&emm_hdr, head);
+		len = emm_hdr.associated_information_length+7;
+		if( (head+len) > tail ){
+			/* broken EMM element */
 			goto LAST;
 		}
-
-		head = sect.data;
-		tail = sect.tail - 4;
-
-		while( (head+13) <= tail ){
-			
-			extract_emm_fixed_part(&emm_hdr, head);
-			len = emm_hdr.associated_information_length+7;
-			if( (head+len) > tail ){
-				/* broken EMM element */
-				goto NEXT;
-			}
-			
-			for(j=0;j<prv->casid.count;j++){
-				if(prv->casid.data[j] == emm_hdr.card_id){
-					n = prv->bcas->proc_emm(prv->bcas, head, len);
-					if(n < 0){
-						r = ARIB_STD_B25_ERROR_EMM_PROC_FAILURE;
-						goto LAST;
-					}
-					unlock_all_decryptor(prv);
+		
+		for(j=0;j<prv->casid.count;j++){
+			if(prv->casid.data[j] == emm_hdr.card_id){
+				n = prv->bcas->proc_emm(prv->bcas, head, len);
+				if(n < 0){
+					r = ARIB_STD_B25_ERROR_EMM_PROC_FAILURE;
+					goto LAST;
 				}
+				unlock_all_decryptor(prv);
 			}
-
-			head += len;
 		}
 
-	NEXT:
-		if(sect.raw != NULL){
-			n = prv->emm->ret(prv->emm, &sect);
-			if( (n < 0) && (r == 0) ){
-				r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-				goto LAST;
-			}
-			memset(&sect, 0, sizeof(sect));
-		}
+		head += len;
 	}
 
 LAST:
-	if(sect.raw != NULL){
-		n = prv->emm->ret(prv->emm, &sect);
-		if( (n < 0) && (r == 0) ){
-			r = ARIB_STD_B25_ERROR_EMM_PARSE_FAILURE;
-		}
-	}
-
 	return r;
 }
 
@@ -2246,6 +2582,7 @@ static void release_program(ARIB_STD_B25_PRIVATE_DATA *prv, TS_PROGRAM *pgrm)
 	prv->map[pid].type = PID_MAP_TYPE_UNKNOWN;
 	prv->map[pid].ref = 0;
 	prv->map[pid].target = NULL;
+	update_pid_hot(prv, pid);
 }
 
 static void unref_stream(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid)
@@ -2265,11 +2602,14 @@ static void unref_stream(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid)
 		prv->map[pid].type = PID_MAP_TYPE_UNKNOWN;
 		prv->map[pid].ref = 0;
 		prv->map[pid].target = NULL;
+		update_pid_hot(prv, pid);
 	}
 }
 
 static DECRYPTOR_ELEM *set_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid)
 {
+	int i;
+
 	DECRYPTOR_ELEM *r;
 
 	r = NULL;
@@ -2284,12 +2624,21 @@ static DECRYPTOR_ELEM *set_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid
 		return NULL;
 	}
 	r->ecm_pid = pid;
-	r->ecm = create_ts_section_parser();
+	r->ecm = create_section_parser(prv, on_ecm_section);
 	if(r->ecm == NULL){
 		free(r);
 		return NULL;
 	}
 
+	/* without a free slot the streams fall back to map[].target */
+	for(i=1;i<=PID_HOT_SLOT_MAX;i++){
+		if(prv->dec_slot[i] == NULL){
+			prv->dec_slot[i] = r;
+			r->slot = i;
+			break;
+		}
+	}
+
 	if(prv->decrypt.tail != NULL){
 		r->prev = prv->decrypt.tail;
 		r->next = NULL;
@@ -2316,6 +2665,7 @@ static DECRYPTOR_ELEM *set_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid
 
 	prv->map[pid].type = PID_MAP_TYPE_ECM;
 	prv->map[pid].target = r;
+	update_pid_hot(prv, pid);
 
 	return r;
 }
@@ -2332,6 +2682,11 @@ static void remove_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, DECRYPTOR_ELEM *dec
 	    (prv->map[pid].target == ((void *)dec)) ){
 		prv->map[pid].type = PID_MAP_TYPE_UNKNOWN;
 		prv->map[pid].target = NULL;
+		update_pid_hot(prv, pid);
+	}
+
+	if(dec->slot != 0){
+		prv->dec_slot[dec->slot] = NULL;
 	}
 
 	prev = (DECRYPTOR_ELEM *)(dec->prev);
@@ -2396,6 +2751,28 @@ static void bind_stream_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid, D
 	}
 }
 
+static void update_pid_hot(ARIB_STD_B25_PRIVATE_DATA *prv, int32_t pid)
+{
+	DECRYPTOR_ELEM *dec;
+
+	switch(prv->map[pid].type){
+	case PID_MAP_TYPE_UNKNOWN:
+		prv->pid_hot[pid] = PID_HOT_UNKNOWN;
+		break;
+	case PID_MAP_TYPE_OTHER:
+		dec = (DECRYPTOR_ELEM *)(prv->map[pid].target);
+		if( (dec != NULL) && (dec->slot != 0) ){
+			prv->pid_hot[pid] = (uint8_t)(dec->slot);
+		}else{
+			prv->pid_hot[pid] = PID_HOT_STREAM;
+		}
+		break;
+	default:
+		prv->pid_hot[pid] = PID_HOT_SECTION;
+		break;
+	}
+}
+
 static void unlock_all_decryptor(ARIB_STD_B25_PRIVATE_DATA *prv)
 {
 	DECRYPTOR_ELEM *e;
@@ -2559,6 +2936,62 @@ static int append_work_buffer(TS_WORK_BUFFER *buf, uint8_t *data, int32_t size)
 	return 1;
 }
 
+static int append_span(TS_WORK_BUFFER *buf, uint8_t **head, uint8_t **tail, uint8_t *curr)
+{
+	/* extends [*head,*tail) by the packet at curr, or writes it out
+	   and starts a new span when curr does not follow it */
+	if(curr != (*tail)){
+		if(!append_work_buffer(buf, *head, (*tail)-(*head))){
+			return 0;
+		}
+		*head = curr;
+	}
+	*tail = curr+188;
+
+	return 1;
+}
+
+/* sbuf is used as a ring of max (a power of two) bytes: consumed data
+   is only skipped by moving head, and when the tail reaches the end of
+   the pool the unconsumed bytes - normally the partial packet left by
+   the last pass - wrap around to its start, so packets never straddle
+   the end. the pool only grows when the unconsumed bytes and the new
+   data together do not fit */
+static int stage_work_buffer(TS_WORK_BUFFER *buf, uint8_t *data, int32_t size)
+{
+	int m;
+
+	if(size < 1){
+		/* ignore - do nothing */
+		return 1;
+	}
+
+	if( (buf->pool == NULL) || (((buf->pool + buf->max) - buf->tail) < size) ){
+		m = buf->tail - buf->head;
+		if( (buf->pool != NULL) && ((m+size) <= buf->max) ){
+			memmove(buf->pool, buf->head, m);
+			buf->head = buf->pool;
+			buf->tail = buf->pool+m;
+		}else if(!reserve_work_buffer(buf, m+size)){
+			return 0;
+		}
+	}
+
+	memcpy(buf->tail, data, size);
+	buf->tail += size;
+
+	return 1;
+}
+
+static void consume_work_buffer(TS_WORK_BUFFER *buf, uint8_t *curr)
+{
+	buf->head = curr;
+	if(buf->head == buf->tail){
+		/* drained - restart at the pool head for free */
+		reset_work_buffer(buf);
+	}
+}
+
 static void reset_work_buffer(TS_WORK_BUFFER *buf)
 {
 	buf->head = buf->pool;
@@ -2604,36 +3037,42 @@ static void extract_emm_fixed_part(EMM_FIXED_PART *dst, uint8_t *src)
 	dst->expiration_date               = (src[11]<<8)|src[12];
 }
 
-static uint8_t *resync(uint8_t *head, uint8_t *tail, int32_t unit_size)
+static uint8_t *resync(const TS_SYNC_SCANNER *sync, uint8_t *head, uint8_t *tail, int32_t unit_size)
 {
-	int i;
-	unsigned char *buf;
-
-	buf = head;
-	tail -= unit_size * 8;
-	while( buf <= tail ){
-		if(buf[0] == 0x47){
-			for(i=1;i<8;i++){
-				if(buf[unit_size*i] != 0x47){
-					break;
-				}
-			}
-			if(i == 8){
-				return buf;
-			}
-		}
-		buf += 1;
+	if( (tail - head) < (unit_size * 8) ){
+		return NULL;
 	}
 
-	return NULL;
+	return sync->find(head, tail - unit_size * 8, unit_size, 8);
 }
 
-static uint8_t *resync_force(uint8_t *head, uint8_t *tail, int32_t unit_size)
+static uint8_t *resync_force(const TS_SYNC_SCANNER *sync, uint8_t *head, uint8_t *tail, int32_t unit_size)
 {
 	int i,n;
 	unsigned char *buf;
 
 	buf = head;
+
+	/* while 8 or more units are left a full chain starts with 8 sync
+	   bytes, so let the scanner skip the positions that cannot match */
+	while( (tail - buf) >= (unit_size * 8) ){
+		buf = sync->find(buf, tail - unit_size * 8, unit_size, 8);
+		if(buf == NULL){
+			buf = tail - unit_size * 8 + 1;
+			break;
+		}
+		n = (tail - buf) / unit_size;
+		for(i=8;i<n;i++){
+			if(buf[unit_size*i] != 0x47){
+				break;
+			}
+		}
+		if(i == n){
+			return buf;
+		}
+		buf += 1;
+	}
+
 	while( buf <= (tail-188) ){
 		if(buf[0] == 0x47){
 			n = (tail - buf) / unit_size;
@@ -45,6 +45,12 @@ typedef struct {
 	int (* get_program_count)(void *std_b25);
 	int (* get_program_info)(void *std_b25, ARIB_STD_B25_PROGRAM_INFO *info, int32_t idx);
 
+	/* decrypts buf in place instead of put()/get(), see arib_std_b25.c */
+	int (* process_inplace)(void *std_b25, uint8_t *buf, int32_t size, int32_t *consumed);
+
+	/* get() into a caller owned buffer, see arib_std_b25.c */
+	int (* get_into)(void *std_b25, uint8_t *dst, int32_t cap, int32_t *written);
+
 } ARIB_STD_B25;
 
 #ifdef __cplusplus
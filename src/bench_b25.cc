@@ -0,0 +1,941 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+# include <windows.h>
+# include <tchar.h>
+#else
+# define TCHAR char
+# define _T(X) X
+# define _tmain main
+# define _tcscmp strcmp
+# define _tfopen fopen
+# define _ttoi atoi
+# include <time.h>
+# include <sys/resource.h>
+#endif
+
+#include "arib_std_b25.h"
+#include "b_cas_card.h"
+#include "b_cas_card_error_code.h"
+#include "multi2.h"
+#include "multi2_cpu.h"
+#include "ts_crc32_kernel.h"
+
+/*
+ * end-to-end ARIB STD-B25 benchmark without a card reader.
+ *
+ * a synthetic transport stream is generated in memory: PAT, CAT and PMT
+ * with a CA descriptor, ECM and EMM sections, and A/V packets scrambled
+ * with MULTI2::encrypt under fixed test keys. it is then pushed through
+ * ARIB_STD_B25::put/get, put/get_into or process_inplace in read sized
+ * chunks, each first copied into a read buffer as read() would do, with
+ * a mock B_CAS_CARD that answers ECMs in-process after a configurable
+ * delay. the output is checked against the plaintext, and throughput,
+ * ECM-to-key latency and peak memory are written as one JSON document
+ * to stdout.
+ *
+ * the mock ECM body is not encrypted: it carries the key epoch and the
+ * odd/even scramble keys in clear, which only the mock card understands.
+ */
+
+enum {
+	PID_PAT   = 0x0000,
+	PID_CAT   = 0x0001,
+	PID_NIT   = 0x0010,
+	PID_EMM   = 0x0021,
+	PID_PMT   = 0x01f0,
+	PID_ECM   = 0x01f1,
+	PID_VIDEO = 0x0111,
+	PID_AUDIO = 0x0112,
+	PID_NULL  = 0x1fff,
+};
+
+enum {
+	CA_SYSTEM_ID    = 0x0005,
+	PROGRAM_NUMBER  = 0x0400,
+	ECM_BODY_SIZE   = 116,
+	EMM_CARD_COUNT  = 8,
+	EMM_INFO_SIZE   = 16,
+};
+
+struct test_keys {
+	uint8_t system_key[32];
+	uint8_t init_cbc[8];
+	int64_t card_id;
+};
+
+struct bench_option {
+	int packets;
+	int unit_size;
+	int chunk;
+	int ecm_interval;
+	int psi_interval;
+	int emm_interval;
+	int latency_us;
+	int round;
+	int trials;
+	bool inplace;
+	bool pull;
+	const TCHAR *output;
+};
+
+static double now_us()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER f, c;
+	QueryPerformanceFrequency(&f);
+	QueryPerformanceCounter(&c);
+	return static_cast<double>(c.QuadPart) * 1e6 / static_cast<double>(f.QuadPart);
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+#endif
+}
+
+/* peak resident set in KiB, -1 where unknown */
+static long max_rss_kb()
+{
+#if defined(_WIN32)
+	return -1;
+#else
+	struct rusage u;
+	if (getrusage(RUSAGE_SELF, &u) != 0) {
+		return -1;
+	}
+# if defined(__APPLE__)
+	return u.ru_maxrss / 1024;
+# else
+	return u.ru_maxrss;
+# endif
+#endif
+}
+
+static uint32_t crc32_mpeg2(const uint8_t *p, size_t n)
+{
+	uint32_t crc = 0xffffffff;
+	for (size_t i = 0; i < n; ++i) {
+		crc ^= static_cast<uint32_t>(p[i]) << 24;
+		for (int j = 0; j < 8; ++j) {
+			crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04c11db7) : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+struct crc32_entry {
+	const char *name;
+	const TS_CRC32 *f;
+	bool usable;
+};
+
+/* every CRC-32 implementation compiled in and usable must agree with the
+   table version on random sections of all sizes and alignments */
+static bool check_crc32(const char *&selected)
+{
+	uint32_t f = multi2::cpu::features();
+	std::vector<crc32_entry> c;
+
+	crc32_entry slice16 = { "slice16", &ts_crc32::slice16, true };
+	c.push_back(slice16);
+#if defined(TS_CRC32_PCLMUL)
+	crc32_entry pclmul = { "pclmul", &ts_crc32::pclmul, (f & multi2::cpu::FEATURE_PCLMUL) && (f & multi2::cpu::FEATURE_SSSE3) };
+	c.push_back(pclmul);
+#endif
+#if defined(TS_CRC32_PMULL)
+	crc32_entry pmull = { "pmull", &ts_crc32::pmull, (f & multi2::cpu::FEATURE_PMULL) != 0 };
+	c.push_back(pmull);
+#endif
+	(void)f;
+
+	const TS_CRC32 *s = select_ts_crc32();
+	selected = "table";
+	for (size_t i = 0; i < c.size(); ++i) {
+		if (c[i].f == s) {
+			selected = c[i].name;
+		}
+	}
+
+	std::vector<uint8_t> buf(4096 + 16);
+	for (int t = 0; t < 2000; ++t) {
+		for (size_t i = 0; i < buf.size(); ++i) {
+			buf[i] = static_cast<uint8_t>(rand());
+		}
+		size_t off = static_cast<size_t>(rand()) % 16;
+		size_t n = (t < 256) ? static_cast<size_t>(t) : static_cast<size_t>(rand()) % 4097;
+		const uint8_t *head = &buf[off];
+		uint32_t expect = ts_crc32::table.calc(head, head + n);
+		if (t < 64 && expect != crc32_mpeg2(head, n)) {
+			return false;
+		}
+		for (size_t i = 0; i < c.size(); ++i) {
+			if (c[i].usable && c[i].f->calc(head, head + n) != expect) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static uint32_t xorshift(uint32_t &s)
+{
+	s ^= s << 13;
+	s ^= s >> 17;
+	s ^= s << 5;
+	return s;
+}
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ mock B-CAS card
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+struct mock_card {
+	B_CAS_CARD          card;
+
+	B_CAS_INIT_STATUS   status;
+	int64_t             id;
+	double              latency_us;
+
+	std::vector<double> reply_us;   /* by key epoch, when proc_ecm returned */
+	int64_t             ecm_count;
+	int64_t             emm_count;
+};
+
+static mock_card *mock_private(void *bcas)
+{
+	return static_cast<mock_card *>(static_cast<B_CAS_CARD *>(bcas)->private_data);
+}
+
+static void release_mock_card(void *bcas)
+{
+	(void)bcas;
+}
+
+static int init_mock_card(void *bcas)
+{
+	(void)bcas;
+	return 0;
+}
+
+static int get_init_status_mock_card(void *bcas, B_CAS_INIT_STATUS *stat)
+{
+	if (stat == NULL) {
+		return B_CAS_CARD_ERROR_INVALID_PARAMETER;
+	}
+	*stat = mock_private(bcas)->status;
+	return 0;
+}
+
+static int get_id_mock_card(void *bcas, B_CAS_ID *dst)
+{
+	if (dst == NULL) {
+		return B_CAS_CARD_ERROR_INVALID_PARAMETER;
+	}
+	dst->data = &mock_private(bcas)->id;
+	dst->count = 1;
+	return 0;
+}
+
+static int get_pwr_on_ctrl_mock_card(void *bcas, B_CAS_PWR_ON_CTRL_INFO *dst)
+{
+	(void)bcas;
+	if (dst == NULL) {
+		return B_CAS_CARD_ERROR_INVALID_PARAMETER;
+	}
+	dst->data = NULL;
+	dst->count = 0;
+	return 0;
+}
+
+static int proc_ecm_mock_card(void *bcas, B_CAS_ECM_RESULT *dst, uint8_t *src, int len)
+{
+	mock_card *prv = mock_private(bcas);
+
+	if (dst == NULL || src == NULL || len < 20) {
+		return B_CAS_CARD_ERROR_INVALID_PARAMETER;
+	}
+
+	/* spin rather than sleep, a card transaction blocks the caller and
+	   scheduler wake-up jitter would swamp sub-millisecond settings */
+	double t = now_us() + prv->latency_us;
+	while (now_us() < t) {
+	}
+
+	uint32_t epoch = (src[0] << 24) | (src[1] << 16) | (src[2] << 8) | src[3];
+	memcpy(dst->scramble_key, src + 4, 16);
+	dst->return_code = 0x0800;
+
+	if (epoch < prv->reply_us.size()) {
+		prv->reply_us[epoch] = now_us();
+	}
+	prv->ecm_count += 1;
+	return 0;
+}
+
+static int proc_emm_mock_card(void *bcas, uint8_t *src, int len)
+{
+	(void)src;
+	(void)len;
+	mock_private(bcas)->emm_count += 1;
+	return 0;
+}
+
+static void setup_mock_card(mock_card &m, const test_keys &k, int latency_us, size_t epochs)
+{
+	memset(&m.card, 0, sizeof(m.card));
+	m.card.private_data    = &m;
+	m.card.release         = release_mock_card;
+	m.card.init            = init_mock_card;
+	m.card.get_init_status = get_init_status_mock_card;
+	m.card.get_id          = get_id_mock_card;
+	m.card.get_pwr_on_ctrl = get_pwr_on_ctrl_mock_card;
+	m.card.proc_ecm        = proc_ecm_mock_card;
+	m.card.proc_emm        = proc_emm_mock_card;
+
+	memset(&m.status, 0, sizeof(m.status));
+	memcpy(m.status.system_key, k.system_key, sizeof(k.system_key));
+	memcpy(m.status.init_cbc, k.init_cbc, sizeof(k.init_cbc));
+	m.status.bcas_card_id = k.card_id;
+	m.status.ca_system_id = CA_SYSTEM_ID;
+
+	m.id = k.card_id;
+	m.latency_us = latency_us;
+	m.reply_us.assign(epochs, -1.0);
+	m.ecm_count = 0;
+	m.emm_count = 0;
+}
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ scrambled stream generator
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+class generator {
+public:
+	generator(const bench_option &opt, const test_keys &k)
+		: opt(opt), keys(k), m2(create_multi2()), seed(0x2545f491), count(0), epoch(0), update(0) {
+
+		memset(cc, 0, sizeof(cc));
+		memset(scramble_key, 0, sizeof(scramble_key));
+
+		m2->set_system_key(m2, const_cast<uint8_t *>(keys.system_key));
+		m2->set_init_cbc(m2, const_cast<uint8_t *>(keys.init_cbc));
+		m2->set_round(m2, opt.round);
+	}
+
+	~generator() {
+		m2->release(m2);
+	}
+
+	void run() {
+		int next_psi = 0;
+		int next_ecm = 0;
+		int next_emm = 0;
+		int video = 0;
+
+		stream.reserve(static_cast<size_t>(opt.packets) * opt.unit_size);
+		plain.reserve(static_cast<size_t>(opt.packets) * 188);
+		clear.reserve(static_cast<size_t>(opt.packets) * opt.unit_size);
+
+		while (count < opt.packets) {
+			if (next_ecm <= count) {
+				next_key();
+				ecm_offset.push_back(stream.size());
+				emit_ecm();
+				next_ecm += opt.ecm_interval;
+			}
+			if (next_psi <= count) {
+				emit_psi();
+				next_psi += opt.psi_interval;
+			}
+			if (0 < opt.emm_interval && next_emm <= count) {
+				emit_emm();
+				next_emm += opt.emm_interval;
+			}
+
+			uint32_t r = xorshift(seed);
+			if ((r & 15) == 15) {
+				emit_null();
+			} else if ((r & 0x70) == 0) {
+				emit_es(PID_AUDIO, false);
+			} else {
+				emit_es(PID_VIDEO, (video++ & 31) == 0);
+			}
+		}
+	}
+
+	/* scrambled input, 188 byte plaintext per packet, plaintext in input
+	   framing, and where each key epoch's ECM starts */
+	std::vector<uint8_t> stream;
+	std::vector<uint8_t> plain;
+	std::vector<uint8_t> clear;
+	std::vector<size_t>  ecm_offset;
+
+private:
+	void next_key() {
+		/* even keys on even epochs, ECM n carries the new key and keeps the one in use */
+		int i = (epoch & 1) ? 0 : 8;
+		for (int j = 0; j < 8; ++j) {
+			scramble_key[i + j] = static_cast<uint8_t>(xorshift(seed));
+		}
+		if (epoch == 0) {
+			for (int j = 0; j < 8; ++j) {
+				scramble_key[j] = static_cast<uint8_t>(xorshift(seed));
+			}
+		}
+		m2->set_scramble_key(m2, scramble_key);
+		body.assign(scramble_key, scramble_key + 16);
+		epoch += 1;
+	}
+
+	int parity() const {
+		/* epoch was advanced by next_key(), so the current one is epoch-1 */
+		return ((epoch - 1) & 1) ? 0x03 : 0x02;
+	}
+
+	void emit_psi() {
+		uint8_t b[32];
+
+		/* PAT */
+		b[0] = 0x00;
+		b[1] = 0x00;
+		b[2] = 0xe0 | (PID_NIT >> 8);
+		b[3] = PID_NIT & 0xff;
+		b[4] = PROGRAM_NUMBER >> 8;
+		b[5] = PROGRAM_NUMBER & 0xff;
+		b[6] = 0xe0 | (PID_PMT >> 8);
+		b[7] = PID_PMT & 0xff;
+		emit_section(PID_PAT, 0x00, 0x0001, 0, b, 8);
+
+		/* CAT */
+		b[0] = 0x09;
+		b[1] = 0x04;
+		b[2] = CA_SYSTEM_ID >> 8;
+		b[3] = CA_SYSTEM_ID & 0xff;
+		b[4] = 0xe0 | (PID_EMM >> 8);
+		b[5] = PID_EMM & 0xff;
+		emit_section(PID_CAT, 0x01, 0xffff, 0, b, 6);
+
+		/* PMT, CA descriptor on program level and two elementary streams */
+		b[0]  = 0xe0 | (PID_VIDEO >> 8);
+		b[1]  = PID_VIDEO & 0xff;
+		b[2]  = 0xf0;
+		b[3]  = 6;
+		b[4]  = 0x09;
+		b[5]  = 0x04;
+		b[6]  = CA_SYSTEM_ID >> 8;
+		b[7]  = CA_SYSTEM_ID & 0xff;
+		b[8]  = 0xe0 | (PID_ECM >> 8);
+		b[9]  = PID_ECM & 0xff;
+		b[10] = 0x02;
+		b[11] = 0xe0 | (PID_VIDEO >> 8);
+		b[12] = PID_VIDEO & 0xff;
+		b[13] = 0xf0;
+		b[14] = 0x00;
+		b[15] = 0x0f;
+		b[16] = 0xe0 | (PID_AUDIO >> 8);
+		b[17] = PID_AUDIO & 0xff;
+		b[18] = 0xf0;
+		b[19] = 0x00;
+		emit_section(PID_PMT, 0x02, PROGRAM_NUMBER, 0, b, 20);
+
+		/* repeated ECM, byte identical to the last one */
+		emit_ecm();
+	}
+
+	void emit_ecm() {
+		uint8_t b[ECM_BODY_SIZE];
+		uint32_t e = epoch - 1;
+
+		b[0] = static_cast<uint8_t>(e >> 24);
+		b[1] = static_cast<uint8_t>(e >> 16);
+		b[2] = static_cast<uint8_t>(e >> 8);
+		b[3] = static_cast<uint8_t>(e);
+		memcpy(b + 4, &body[0], 16);
+		for (int i = 20; i < ECM_BODY_SIZE; ++i) {
+			b[i] = static_cast<uint8_t>(e * 31 + i);
+		}
+		emit_section(PID_ECM, 0x82, 0x0000, e, b, ECM_BODY_SIZE);
+	}
+
+	void emit_emm() {
+		uint8_t b[EMM_CARD_COUNT * (13 + EMM_INFO_SIZE)];
+		uint8_t *p = b;
+
+		/* one entry addressed to the mock card among others */
+		for (int i = 0; i < EMM_CARD_COUNT; ++i) {
+			int64_t id = (i == EMM_CARD_COUNT / 2) ? keys.card_id : keys.card_id + 0x100 * (i + 1);
+			for (int j = 0; j < 6; ++j) {
+				p[j] = static_cast<uint8_t>(id >> (40 - 8 * j));
+			}
+			p[6]  = 6 + EMM_INFO_SIZE;
+			p[7]  = 0x00;
+			p[8]  = 0x01;
+			p[9]  = static_cast<uint8_t>(update >> 8);
+			p[10] = static_cast<uint8_t>(update);
+			p[11] = 0xff;
+			p[12] = 0xff;
+			for (int j = 0; j < EMM_INFO_SIZE; ++j) {
+				p[13 + j] = static_cast<uint8_t>(xorshift(seed));
+			}
+			p += 13 + EMM_INFO_SIZE;
+		}
+		emit_section(PID_EMM, 0x84, update & 0xffff, update, b, static_cast<int>(p - b));
+		update += 1;
+	}
+
+	/* long form section with CRC, split over as many packets as it needs */
+	void emit_section(int pid, int table_id, int ext, int version, const uint8_t *body, int size) {
+		std::vector<uint8_t> s(8 + size + 4);
+		int length = 5 + size + 4;
+
+		s[0] = static_cast<uint8_t>(table_id);
+		s[1] = 0xb0 | ((length >> 8) & 0x0f);
+		s[2] = length & 0xff;
+		s[3] = static_cast<uint8_t>(ext >> 8);
+		s[4] = static_cast<uint8_t>(ext);
+		s[5] = 0xc1 | ((version & 0x1f) << 1);
+		s[6] = 0x00;
+		s[7] = 0x00;
+		memcpy(&s[8], body, size);
+
+		uint32_t crc = crc32_mpeg2(&s[0], 8 + size);
+		s[8 + size + 0] = static_cast<uint8_t>(crc >> 24);
+		s[8 + size + 1] = static_cast<uint8_t>(crc >> 16);
+		s[8 + size + 2] = static_cast<uint8_t>(crc >> 8);
+		s[8 + size + 3] = static_cast<uint8_t>(crc);
+
+		size_t off = 0;
+		bool first = true;
+		while (off < s.size()) {
+			uint8_t pkt[188];
+			uint8_t *p = header(pkt, pid, first, 0);
+			if (first) {
+				*p++ = 0x00; /* pointer_field */
+			}
+			size_t n = (pkt + 188) - p;
+			if (s.size() - off < n) {
+				n = s.size() - off;
+			}
+			memcpy(p, &s[off], n);
+			memset(p + n, 0xff, (pkt + 188) - (p + n));
+			off += n;
+			first = false;
+			put(pkt, 0, 0);
+		}
+	}
+
+	void emit_es(int pid, bool pcr) {
+		uint8_t pkt[188];
+		uint8_t *p = header(pkt, pid, false, pcr ? 7 : -1);
+		uint8_t *tail = pkt + 188;
+
+		for (uint8_t *q = p; q < tail; ++q) {
+			*q = static_cast<uint8_t>(xorshift(seed));
+		}
+		put(pkt, parity(), static_cast<int>(tail - p));
+	}
+
+	void emit_null() {
+		uint8_t pkt[188];
+		uint8_t *p = header(pkt, PID_NULL, false, -1);
+		memset(p, 0xff, (pkt + 188) - p);
+		put(pkt, 0, 0);
+	}
+
+	/* writes the TS header and an optional adaptation field, returns the payload */
+	uint8_t *header(uint8_t *pkt, int pid, bool pusi, int af_length) {
+		pkt[0] = 0x47;
+		pkt[1] = (pusi ? 0x40 : 0x00) | ((pid >> 8) & 0x1f);
+		pkt[2] = pid & 0xff;
+		pkt[3] = ((0 <= af_length) ? 0x30 : 0x10) | (cc[pid] & 0x0f);
+		cc[pid] += 1;
+
+		uint8_t *p = pkt + 4;
+		if (0 <= af_length) {
+			p[0] = static_cast<uint8_t>(af_length);
+			memset(p + 1, 0, af_length);
+			if (0 < af_length) {
+				p[1] = 0x10; /* PCR_flag */
+			}
+			p += 1 + af_length;
+		}
+		return p;
+	}
+
+	/* records the plaintext, scrambles the trailing n payload bytes and appends the unit */
+	void put(uint8_t *pkt, int crypt, int n) {
+		plain.insert(plain.end(), pkt, pkt + 188);
+		clear.insert(clear.end(), pkt, pkt + 188);
+
+		if (crypt != 0) {
+			m2->encrypt(m2, crypt, pkt + 188 - n, n);
+			pkt[3] |= static_cast<uint8_t>(crypt << 6);
+		}
+		stream.insert(stream.end(), pkt, pkt + 188);
+
+		/* 192/204 byte units carry a time stamp or parity after the packet */
+		for (int i = 188; i < opt.unit_size; ++i) {
+			stream.push_back(0x00);
+			clear.push_back(0x00);
+		}
+		count += 1;
+	}
+
+	const bench_option &opt;
+	const test_keys &keys;
+
+	MULTI2 *m2;
+	uint32_t seed;
+
+	int count;
+	uint32_t epoch;
+	int update;
+
+	uint8_t cc[0x2000];
+	uint8_t scramble_key[16];
+	std::vector<uint8_t> body;
+};
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ benchmark
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+struct trial_result {
+	int    error;
+	bool   verified;
+	double us;
+	std::vector<double> latency_us;
+	int64_t ecm_count;
+	int64_t emm_count;
+};
+
+/* compares decoder output with the expected plaintext at pos */
+static bool check_output(const uint8_t *data, size_t size, const std::vector<uint8_t> &expect, size_t &pos)
+{
+	if (size == 0) {
+		return true;
+	}
+	if (expect.size() - pos < size) {
+		pos = expect.size();
+		return false;
+	}
+	bool ok = (memcmp(data, &expect[pos], size) == 0);
+	pos += size;
+	return ok;
+}
+
+static bool check_output(ARIB_STD_B25 *b25, const std::vector<uint8_t> &expect, size_t &pos)
+{
+	ARIB_STD_B25_BUFFER buf;
+	if (b25->get(b25, &buf) < 0) {
+		return false;
+	}
+	return check_output(buf.data, (0 < buf.size) ? buf.size : 0, expect, pos);
+}
+
+/* drains get_into() through a fixed output buffer */
+static bool check_output(ARIB_STD_B25 *b25, std::vector<uint8_t> &obuf, const std::vector<uint8_t> &expect, size_t &pos)
+{
+	bool ok = true;
+	for (;;) {
+		int32_t n = 0;
+		if (b25->get_into(b25, &obuf[0], static_cast<int32_t>(obuf.size()), &n) < 0) {
+			return false;
+		}
+		if (n == 0) {
+			return ok;
+		}
+		ok = check_output(&obuf[0], n, expect, pos) && ok;
+	}
+}
+
+static trial_result run_trial(const bench_option &opt, const test_keys &k, const generator &g)
+{
+	trial_result r;
+	r.error = 0;
+	r.verified = false;
+	r.us = 0;
+	r.ecm_count = 0;
+	r.emm_count = 0;
+
+	size_t epochs = g.ecm_offset.size();
+	std::vector<double> put_us(epochs, -1.0);
+
+	mock_card card;
+	setup_mock_card(card, k, opt.latency_us, epochs);
+
+	ARIB_STD_B25 *b25 = create_arib_std_b25();
+	if (b25 == NULL) {
+		r.error = -1;
+		return r;
+	}
+	b25->set_multi2_round(b25, opt.round);
+	b25->set_strip(b25, 0);
+	b25->set_emm_proc(b25, 0 < opt.emm_interval);
+	r.error = b25->set_b_cas_card(b25, &card.card);
+	if (r.error < 0) {
+		b25->release(b25);
+		return r;
+	}
+
+	const std::vector<uint8_t> &s = g.stream;
+	const std::vector<uint8_t> &expect = opt.inplace ? g.clear : g.plain;
+	size_t pos = 0;
+	size_t out = 0;
+	size_t e = 1;
+	bool ok = true;
+
+	/* the read buffer, starting with what process_inplace() handed back */
+	std::vector<uint8_t> rbuf(opt.chunk + 32 * opt.unit_size);
+	size_t held = 0;
+
+	/* the caller owned output buffer for get_into() */
+	std::vector<uint8_t> obuf((opt.chunk < 188) ? 188 : opt.chunk);
+
+	double t0 = now_us();
+	while (pos < s.size()) {
+		/* later ECMs start a chunk of their own so their put() time is exact,
+		   the first one stays with the PAT/PMT that the unit size search needs */
+		if (e < epochs && g.ecm_offset[e] == pos) {
+			put_us[e] = now_us();
+			e += 1;
+		}
+		size_t end = pos + opt.chunk;
+		if (pos == 0 && opt.chunk < 32 * opt.unit_size) {
+			/* the unit size search rejects a first put() of fewer than 8 packets */
+			end = 32 * opt.unit_size;
+		}
+		if (s.size() < end) {
+			end = s.size();
+		}
+		if (e < epochs && g.ecm_offset[e] < end) {
+			end = g.ecm_offset[e];
+		}
+
+		size_t n = end - pos;
+		if (rbuf.size() < held + n) {
+			rbuf.resize(held + n);
+		}
+		memcpy(&rbuf[held], &s[pos], n);
+
+		if (opt.inplace) {
+			int32_t done = 0;
+			r.error = b25->process_inplace(b25, &rbuf[0], static_cast<int32_t>(held + n), &done);
+			if (r.error < 0) {
+				break;
+			}
+			ok = check_output(&rbuf[0], done, expect, out) && ok;
+			held = held + n - done;
+			memmove(&rbuf[0], &rbuf[done], held);
+		} else {
+			ARIB_STD_B25_BUFFER buf;
+			buf.data = &rbuf[0];
+			buf.size = static_cast<int32_t>(n);
+			r.error = b25->put(b25, &buf);
+			if (r.error < 0) {
+				break;
+			}
+			if (opt.pull) {
+				ok = check_output(b25, obuf, expect, out) && ok;
+			} else {
+				ok = check_output(b25, expect, out) && ok;
+			}
+		}
+		pos = end;
+	}
+	if (0 <= r.error && !opt.inplace) {
+		r.error = b25->flush(b25);
+		if (opt.pull) {
+			ok = check_output(b25, obuf, expect, out) && ok;
+		} else {
+			ok = check_output(b25, expect, out) && ok;
+		}
+	}
+	r.us = now_us() - t0;
+
+	b25->release(b25);
+
+	r.verified = ok && (0 <= r.error) && (out == expect.size());
+	for (size_t i = 1; i < epochs; ++i) {
+		if (0 <= put_us[i] && 0 <= card.reply_us[i]) {
+			r.latency_us.push_back(card.reply_us[i] - put_us[i]);
+		}
+	}
+	r.ecm_count = card.ecm_count;
+	r.emm_count = card.emm_count;
+	return r;
+}
+
+static void show_usage()
+{
+	fprintf(stderr, "usage: bench_b25 [options]\n");
+	fprintf(stderr, "options:\n");
+	fprintf(stderr, "  -n packets  stream length in TS packets (default=200000)\n");
+	fprintf(stderr, "  -u unit     unit size, 188, 192 or 204 (default=188)\n");
+	fprintf(stderr, "  -c bytes    bytes per put() call (default=65536)\n");
+	fprintf(stderr, "  -e packets  packets between key changes (default=4096)\n");
+	fprintf(stderr, "  -p packets  packets between PAT/CAT/PMT/ECM repeats (default=1024)\n");
+	fprintf(stderr, "  -m packets  packets between EMMs, 0 sends none (default=0)\n");
+	fprintf(stderr, "  -l usec     mock card ECM response time (default=0)\n");
+	fprintf(stderr, "  -r round    MULTI2 round (default=4)\n");
+	fprintf(stderr, "  -t trials   decode runs, the fastest one is reported (default=3)\n");
+	fprintf(stderr, "  -i          decode with process_inplace() instead of put()/get()\n");
+	fprintf(stderr, "  -g          read output with get_into() into a chunk sized buffer\n");
+	fprintf(stderr, "  -o file     write the scrambled stream to file and exit\n");
+}
+
+int _tmain(int argc, TCHAR **argv)
+{
+	bench_option opt;
+	opt.packets = 200000;
+	opt.unit_size = 188;
+	opt.chunk = 64 * 1024;
+	opt.ecm_interval = 4096;
+	opt.psi_interval = 1024;
+	opt.emm_interval = 0;
+	opt.latency_us = 0;
+	opt.round = 4;
+	opt.trials = 3;
+	opt.inplace = false;
+	opt.pull = false;
+	opt.output = NULL;
+
+	for (int i = 1; i < argc; ++i) {
+		if (_tcscmp(argv[i], _T("-i")) == 0) {
+			opt.inplace = true;
+			continue;
+		}
+		if (_tcscmp(argv[i], _T("-g")) == 0) {
+			opt.pull = true;
+			continue;
+		}
+		if (_tcscmp(argv[i], _T("-h")) == 0 || _tcscmp(argv[i], _T("--help")) == 0 || i + 1 == argc) {
+			show_usage();
+			return EXIT_FAILURE;
+		}
+		if (_tcscmp(argv[i], _T("-n")) == 0) {
+			opt.packets = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-u")) == 0) {
+			opt.unit_size = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-c")) == 0) {
+			opt.chunk = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-e")) == 0) {
+			opt.ecm_interval = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-p")) == 0) {
+			opt.psi_interval = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-m")) == 0) {
+			opt.emm_interval = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-l")) == 0) {
+			opt.latency_us = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-r")) == 0) {
+			opt.round = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-t")) == 0) {
+			opt.trials = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-o")) == 0) {
+			opt.output = argv[++i];
+		} else {
+			show_usage();
+			return EXIT_FAILURE;
+		}
+	}
+	if ((opt.unit_size != 188 && opt.unit_size != 192 && opt.unit_size != 204) ||
+	    opt.packets < 64 || opt.chunk < 1 || opt.ecm_interval < 1 || opt.psi_interval < 1 ||
+	    opt.emm_interval < 0 || opt.latency_us < 0 || opt.round < 1) {
+		show_usage();
+		return EXIT_FAILURE;
+	}
+	if (opt.trials < 1) {
+		opt.trials = 1;
+	}
+
+	test_keys k;
+	for (int i = 0; i < 32; ++i) {
+		k.system_key[i] = static_cast<uint8_t>(0x36 + 7 * i);
+	}
+	for (int i = 0; i < 8; ++i) {
+		k.init_cbc[i] = static_cast<uint8_t>(0xfe - 13 * i);
+	}
+	k.card_id = 0x000123456789LL;
+
+	generator g(opt, k);
+	g.run();
+
+	if (opt.output != NULL) {
+		FILE *f = _tfopen(opt.output, _T("wb"));
+		if (f == NULL) {
+			fprintf(stderr, "error - failed to open output file\n");
+			return EXIT_FAILURE;
+		}
+		size_t n = fwrite(&g.stream[0], 1, g.stream.size(), f);
+		fclose(f);
+		return (n == g.stream.size()) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	long rss_base = max_rss_kb();
+
+	trial_result best;
+	best.error = 0;
+	best.verified = false;
+	best.us = 0;
+	best.ecm_count = 0;
+	best.emm_count = 0;
+	bool verified = true;
+	int error = 0;
+	std::vector<double> latency;
+	for (int i = 0; i < opt.trials; ++i) {
+		trial_result r = run_trial(opt, k, g);
+		verified = verified && r.verified;
+		if (r.error < 0) {
+			error = r.error;
+		}
+		latency.insert(latency.end(), r.latency_us.begin(), r.latency_us.end());
+		if (i == 0 || r.us < best.us) {
+			best = r;
+		}
+	}
+
+	long rss_peak = max_rss_kb();
+
+	const char *crc32_name = NULL;
+	bool crc32_verified = check_crc32(crc32_name);
+	verified = verified && crc32_verified;
+
+	double lat_min = 0, lat_max = 0, lat_sum = 0;
+	for (size_t i = 0; i < latency.size(); ++i) {
+		if (i == 0 || latency[i] < lat_min) {
+			lat_min = latency[i];
+		}
+		if (i == 0 || lat_max < latency[i]) {
+			lat_max = latency[i];
+		}
+		lat_sum += latency[i];
+	}
+
+	double bytes = static_cast<double>(g.stream.size());
+
+	printf("{\n");
+	printf("  \"mode\": \"%s\", \"packets\": %d, \"unit_size\": %d, \"chunk\": %d, \"round\": %d,\n",
+		opt.inplace ? "inplace" : (opt.pull ? "get_into" : "put"), opt.packets, opt.unit_size, opt.chunk, opt.round);
+	printf("  \"ecm_interval\": %d, \"psi_interval\": %d, \"emm_interval\": %d, \"card_latency_us\": %d,\n",
+		opt.ecm_interval, opt.psi_interval, opt.emm_interval, opt.latency_us);
+	printf("  \"verified\": %s, \"error\": %d,\n", verified ? "true" : "false", error);
+	printf("  \"packets_per_s\": %.0f, \"mbit_per_s\": %.1f,\n",
+		opt.packets / (best.us / 1e6), bytes * 8 / best.us);
+	printf("  \"ecm_count\": %lld, \"emm_count\": %lld,\n",
+		static_cast<long long>(best.ecm_count), static_cast<long long>(best.emm_count));
+	if (latency.empty()) {
+		printf("  \"ecm_latency_us\": null,\n");
+	} else {
+		printf("  \"ecm_latency_us\": {\"count\": %d, \"min\": %.1f, \"mean\": %.1f, \"max\": %.1f},\n",
+			static_cast<int>(latency.size()), lat_min, lat_sum / latency.size(), lat_max);
+	}
+	printf("  \"crc32\": {\"selected\": \"%s\", \"verified\": %s},\n", crc32_name, crc32_verified ? "true" : "false");
+	if (rss_base < 0) {
+		printf("  \"max_rss_kb\": null, \"decoder_rss_kb\": null\n");
+	} else {
+		printf("  \"max_rss_kb\": %ld, \"decoder_rss_kb\": %ld\n", rss_peak, rss_peak - rss_base);
+	}
+	printf("}\n");
+
+	return verified ? EXIT_SUCCESS : EXIT_FAILURE;
+}
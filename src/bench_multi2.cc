@@ -0,0 +1,378 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+# include <windows.h>
+# include <tchar.h>
+#else
+# define TCHAR char
+# define _T(X) X
+# define _tmain main
+# define _tcscmp strcmp
+# define _ttoi atoi
+# include <time.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+# define BENCH_TSC
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+#endif
+
+#include "multi2_kernel.h"
+#include "multi2_cpu.h"
+
+#include "multi2_compat.h"
+#include "multi2_cipher.h"
+
+/*
+ * MULTI2 kernel microbenchmark.
+ *
+ * times every kernel compiled in and supported by the running CPU, plus
+ * the scalar encrypt_cbc_ofb(), over payload sizes, round counts and
+ * batch sizes. each point is the best of several trials, written as one
+ * JSON document to stdout.
+ */
+
+struct kernel_entry {
+	const char *name;
+	const multi2::kernel::functions *f;
+	bool usable;
+};
+
+struct bench_option {
+	std::vector<int> sizes;
+	std::vector<int> rounds;
+	std::vector<int> batches;
+	int trial_us;
+	int trials;
+};
+
+static double now_us()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER f, c;
+	QueryPerformanceFrequency(&f);
+	QueryPerformanceCounter(&c);
+	return static_cast<double>(c.QuadPart) * 1e6 / static_cast<double>(f.QuadPart);
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+#endif
+}
+
+static uint64_t cycles()
+{
+#if defined(BENCH_TSC)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static std::vector<kernel_entry> kernels()
+{
+	using namespace multi2;
+
+	uint32_t f = cpu::features();
+	std::vector<kernel_entry> r;
+
+	kernel_entry generic = { "generic", &kernel::generic, true };
+	r.push_back(generic);
+#if defined(MULTI2_KERNEL_SSE41)
+	kernel_entry sse41 = { "sse41", &kernel::sse41, (f & cpu::FEATURE_SSSE3) && (f & cpu::FEATURE_SSE41) };
+	r.push_back(sse41);
+#endif
+#if defined(MULTI2_KERNEL_AVX2)
+	kernel_entry avx2 = { "avx2", &kernel::avx2, (f & cpu::FEATURE_AVX2) != 0 };
+	r.push_back(avx2);
+#endif
+#if defined(MULTI2_KERNEL_AVX512)
+	kernel_entry avx512 = { "avx512", &kernel::avx512, (f & cpu::FEATURE_AVX512F) && (f & cpu::FEATURE_AVX512BW) };
+	r.push_back(avx512);
+#endif
+#if defined(MULTI2_KERNEL_SVE)
+	kernel_entry sve = { "sve", &kernel::sve, (f & cpu::FEATURE_SVE) != 0 };
+	r.push_back(sve);
+#endif
+#if defined(MULTI2_KERNEL_RVV)
+	kernel_entry rvv = { "rvv", &kernel::rvv, (f & cpu::FEATURE_RVV) != 0 };
+	r.push_back(rvv);
+#endif
+
+	(void)f;
+	return r;
+}
+
+/* one measured operation over batch payloads of size bytes */
+class job {
+public:
+	enum op_type {
+		DECRYPT,
+		DECRYPT_BATCH,
+		ENCRYPT,
+		ENCRYPT_BATCH,
+	};
+
+	job(const multi2::kernel::functions *f, op_type op, int size, int round, int batch)
+		: f(f), op(op), size(size), round(round), batch(batch),
+		  data(static_cast<size_t>(size) * batch), ptr(batch), len(batch, size) {
+
+		for (size_t i = 0; i < data.size(); ++i) {
+			data[i] = static_cast<uint8_t>(rand());
+		}
+		for (int i = 0; i < batch; ++i) {
+			ptr[i] = &data[static_cast<size_t>(i) * size];
+		}
+
+		for (size_t i = 0; i < 2; ++i) {
+			iv[i] = rand();
+		}
+		multi2::data_key_type dk;
+		multi2::system_key_type sk;
+		dk[0] = rand();
+		dk[1] = rand();
+		for (size_t i = 0; i < 8; ++i) {
+			sk[i] = rand();
+		}
+		key = multi2::schedule(dk, sk);
+		wide = multi2::widen(key);
+	}
+
+	void run(int n) {
+		for (int i = 0; i < n; ++i) {
+			switch (op) {
+			case DECRYPT:
+				for (int j = 0; j < batch; ++j) {
+					f->decrypt_cbc_ofb(ptr[j], size, &iv[0], &wide[0][0], round);
+				}
+				break;
+			case DECRYPT_BATCH:
+				f->decrypt_batch(&ptr[0], &len[0], batch, &iv[0], &wide[0][0], round);
+				break;
+			case ENCRYPT:
+				for (int j = 0; j < batch; ++j) {
+					multi2::encrypt_cbc_ofb(ptr[j], size, iv, key, round);
+				}
+				break;
+			case ENCRYPT_BATCH:
+				f->encrypt_batch(&ptr[0], &len[0], batch, &iv[0], &wide[0][0], round);
+				break;
+			}
+		}
+	}
+
+	size_t bytes() const { return data.size(); }
+
+private:
+	const multi2::kernel::functions *f;
+	op_type op;
+	int size;
+	int round;
+	int batch;
+
+	std::vector<uint8_t> data;
+	std::vector<uint8_t *> ptr;
+	std::vector<int32_t> len;
+
+	multi2::iv_type iv;
+	multi2::work_key_type key;
+	multi2::wide_key_type wide;
+};
+
+struct result {
+	double us_per_call;
+	double cycles_per_call;
+};
+
+static result measure(job &j, const bench_option &opt)
+{
+	/* grow the repeat count until one trial takes about trial_us */
+	int n = 1;
+	for (;;) {
+		double t0 = now_us();
+		j.run(n);
+		double t = now_us() - t0;
+		if (opt.trial_us <= t * 2 || (1 << 24) <= n) {
+			break;
+		}
+		n *= 2;
+	}
+
+	result best = { 0, 0 };
+	for (int i = 0; i < opt.trials; ++i) {
+		double   t0 = now_us();
+		uint64_t c0 = cycles();
+		j.run(n);
+		uint64_t c = cycles() - c0;
+		double   t = now_us() - t0;
+
+		if (i == 0 || t / n < best.us_per_call) {
+			best.us_per_call     = t / n;
+			best.cycles_per_call = static_cast<double>(c) / n;
+		}
+	}
+	return best;
+}
+
+static const char *op_name(job::op_type op)
+{
+	switch (op) {
+	case job::DECRYPT:       return "decrypt";
+	case job::DECRYPT_BATCH: return "decrypt_batch";
+	case job::ENCRYPT:       return "encrypt";
+	case job::ENCRYPT_BATCH: return "encrypt_batch";
+	}
+	return "";
+}
+
+static bool first_record = true;
+
+static void emit(const char *kernel, job::op_type op, int size, int round, int batch, job &j, const bench_option &opt)
+{
+	result r = measure(j, opt);
+	double bytes = static_cast<double>(j.bytes());
+
+	printf("%s\n    {\"kernel\": \"%s\", \"op\": \"%s\", \"size\": %d, \"round\": %d, \"batch\": %d, ",
+		first_record ? "" : ",", kernel, op_name(op), size, round, batch);
+#if defined(BENCH_TSC)
+	printf("\"cycles_per_byte\": %.3f, ", r.cycles_per_call / bytes);
+#else
+	printf("\"cycles_per_byte\": null, ");
+#endif
+	printf("\"gb_per_s\": %.4f}", bytes / (r.us_per_call * 1e3));
+
+	first_record = false;
+	fflush(stdout);
+}
+
+static void parse_list(std::vector<int> &dst, const TCHAR *s)
+{
+	dst.clear();
+	if (_tcscmp(s, _T("all")) == 0) {
+		for (int i = 1; i <= 184; ++i) {
+			dst.push_back(i);
+		}
+		return;
+	}
+
+	const TCHAR *p = s;
+	while (*p) {
+		int v = _ttoi(p);
+		if (0 < v) {
+			dst.push_back(v);
+		}
+		while (*p && *p != _T(',')) {
+			++p;
+		}
+		if (*p) {
+			++p;
+		}
+	}
+}
+
+static void show_usage()
+{
+	fprintf(stderr, "usage: bench_multi2 [options]\n");
+	fprintf(stderr, "options:\n");
+	fprintf(stderr, "  -s sizes   payload sizes, comma separated or 'all' for 1-184\n");
+	fprintf(stderr, "             (default=1,8,16,64,100,128,176,183,184)\n");
+	fprintf(stderr, "  -r rounds  round counts, comma separated (default=4,8)\n");
+	fprintf(stderr, "  -b batches batch sizes, comma separated (default=1,16,64,256)\n");
+	fprintf(stderr, "  -t usec    target duration of one trial (default=2000)\n");
+	fprintf(stderr, "  -n trials  trials per point, the best one is reported (default=5)\n");
+}
+
+int _tmain(int argc, TCHAR **argv)
+{
+	static const int default_sizes[] = { 1, 8, 16, 64, 100, 128, 176, 183, 184 };
+	static const int default_batches[] = { 1, 16, 64, 256 };
+
+	bench_option opt;
+	opt.sizes.assign(default_sizes, default_sizes + sizeof(default_sizes) / sizeof(default_sizes[0]));
+	opt.rounds.push_back(multi2::COMMON_ROUND);
+	opt.rounds.push_back(8);
+	opt.batches.assign(default_batches, default_batches + sizeof(default_batches) / sizeof(default_batches[0]));
+	opt.trial_us = 2000;
+	opt.trials = 5;
+
+	for (int i = 1; i < argc; ++i) {
+		if (_tcscmp(argv[i], _T("-h")) == 0 || _tcscmp(argv[i], _T("--help")) == 0 || i + 1 == argc) {
+			show_usage();
+			return EXIT_FAILURE;
+		}
+		if (_tcscmp(argv[i], _T("-s")) == 0) {
+			parse_list(opt.sizes, argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-r")) == 0) {
+			parse_list(opt.rounds, argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-b")) == 0) {
+			parse_list(opt.batches, argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-t")) == 0) {
+			opt.trial_us = _ttoi(argv[++i]);
+		} else if (_tcscmp(argv[i], _T("-n")) == 0) {
+			opt.trials = _ttoi(argv[++i]);
+		} else {
+			show_usage();
+			return EXIT_FAILURE;
+		}
+	}
+	if (opt.trials < 1) {
+		opt.trials = 1;
+	}
+
+	srand(1);
+
+	std::vector<kernel_entry> k = kernels();
+	const multi2::kernel::functions *selected = &multi2::kernel::select();
+
+	printf("{\n  \"cycle_counter\": %s,\n  \"kernels\": [",
+#if defined(BENCH_TSC)
+		"\"tsc\""
+#else
+		"null"
+#endif
+	);
+	for (size_t i = 0; i < k.size(); ++i) {
+		printf("%s{\"name\": \"%s\", \"usable\": %s, \"selected\": %s}", (i == 0) ? "" : ", ",
+			k[i].name, k[i].usable ? "true" : "false", (k[i].f == selected) ? "true" : "false");
+	}
+	printf("],\n  \"results\": [");
+
+	for (size_t r = 0; r < opt.rounds.size(); ++r) {
+		int round = opt.rounds[r];
+		for (size_t s = 0; s < opt.sizes.size(); ++s) {
+			int size = opt.sizes[s];
+
+			job e(k[0].f, job::ENCRYPT, size, round, 1);
+			emit("scalar", job::ENCRYPT, size, round, 1, e, opt);
+
+			for (size_t i = 0; i < k.size(); ++i) {
+				if (!k[i].usable) {
+					continue;
+				}
+
+				job d(k[i].f, job::DECRYPT, size, round, 1);
+				emit(k[i].name, job::DECRYPT, size, round, 1, d, opt);
+
+				for (size_t b = 0; b < opt.batches.size(); ++b) {
+					int batch = opt.batches[b];
+
+					job db(k[i].f, job::DECRYPT_BATCH, size, round, batch);
+					emit(k[i].name, job::DECRYPT_BATCH, size, round, batch, db, opt);
+
+					job eb(k[i].f, job::ENCRYPT_BATCH, size, round, batch);
+					emit(k[i].name, job::ENCRYPT_BATCH, size, round, batch, eb, opt);
+				}
+			}
+		}
+	}
+
+	printf("\n  ]\n}\n");
+	return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include <cstddef>
 #include <new>
+#include <vector>
 
 #include "multi2.h"
 #include "multi2_error_code.h"
@@ -7,6 +8,7 @@
 
 #include "multi2_compat.h"
 #include "multi2_cipher.h"
+#include "multi2_kernel.h"
 
 namespace multi2 {
 
@@ -14,11 +16,14 @@ struct multi2 : public MULTI2 {
 	uint32_t ref_count;
 	uint32_t round;
 
+	const kernel::functions *simd;
+
 	optional<system_key_type> system_key;
 	optional<iv_type> iv;
 
 	array<optional<data_key_type>, 2> data_key;
 	array<optional<work_key_type>, 2> work_key;
+	array<wide_key_type, 2> wide_key;
 
 	inline void set_system_key(uint8_t *p) {
 		system_key_type s;
@@ -57,9 +62,17 @@ struct multi2 : public MULTI2 {
 		}
 	}
 
-	inline int encrypt(int32_t type, uint8_t *b, size_t n) {
-		int i = (type == 0x02);
+	inline void set_work_key(int i, const work_key_type &w) {
+		work_key[i] = w;
+		wide_key[i] = widen(w);
+	}
+
+	/* a work key set_work_keys() left to be scheduled */
+	inline bool pending(int i) {
+		return system_key && data_key[i] && !work_key[i];
+	}
 
+	inline int prepare(int i) {
 		if (!iv) {
 			return MULTI2_ERROR_UNSET_CBC_INIT;
 		}
@@ -71,7 +84,18 @@ struct multi2 : public MULTI2 {
 			if (!data_key[i]) {
 				return MULTI2_ERROR_UNSET_SCRAMBLE_KEY;
 			}
-			work_key[i] = schedule(*data_key[i], *system_key);
+			set_work_key(i, schedule(*data_key[i], *system_key));
+		}
+
+		return 0;
+	}
+
+	inline int encrypt(int32_t type, uint8_t *b, size_t n) {
+		int i = (type == 0x02);
+
+		int r = prepare(i);
+		if (r < 0) {
+			return r;
 		}
 
 		encrypt_cbc_ofb(b, n, *iv, *work_key[i], round);
@@ -81,21 +105,36 @@ struct multi2 : public MULTI2 {
 	inline int decrypt(int32_t type, uint8_t *b, size_t n) {
 		int i = (type == 0x02);
 
-		if (!iv) {
-			return MULTI2_ERROR_UNSET_CBC_INIT;
+		int r = prepare(i);
+		if (r < 0) {
+			return r;
 		}
 
-		if (!work_key[i]) {
-			if (!system_key) {
-				return MULTI2_ERROR_UNSET_SYSTEM_KEY;
-			}
-			if (!data_key[i]) {
-				return MULTI2_ERROR_UNSET_SCRAMBLE_KEY;
+		simd->decrypt_cbc_ofb(b, n, &(*iv)[0], &wide_key[i][0][0], round);
+		return 0;
+	}
+
+	/* runs of payloads sharing a key are handed to the kernel in one call */
+	inline int crypt_batch(kernel::crypt_batch_type f, const int32_t *type, uint8_t **b, const int32_t *n, size_t count) {
+		for (size_t j = 0; j < count; ++j) {
+			int r = prepare(type[j] == 0x02);
+			if (r < 0) {
+				return r;
 			}
-			work_key[i] = schedule(*data_key[i], *system_key);
 		}
 
-		decrypt_cbc_ofb(b, n, *iv, *work_key[i], round);
+		size_t j = 0;
+		while (j < count) {
+			int i = (type[j] == 0x02);
+
+			size_t e = j + 1;
+			while (e < count && (type[e] == 0x02) == i) {
+				++e;
+			}
+
+			f(b + j, n + j, e - j, &(*iv)[0], &wide_key[i][0][0], round);
+			j = e;
+		}
 		return 0;
 	}
 };
@@ -114,6 +153,14 @@ static int set_scramble_key_multi2(void *m2, uint8_t *val);
 static int clear_scramble_key_multi2(void *m2);
 static int encrypt_multi2(void *m2, int32_t type, uint8_t *buf, int32_t size);
 static int decrypt_multi2(void *m2, int32_t type, uint8_t *buf, int32_t size);
+static int encrypt_batch_multi2(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count);
+static int decrypt_batch_multi2(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count);
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ function prottypes (private method)
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+static multi2::multi2 *private_data(void *m2);
+static bool check_batch(const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count);
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  global function implementation
@@ -130,6 +177,8 @@ ARIB25_API_EXPORT MULTI2 *create_multi2()
 	m2->ref_count = 1;
 	m2->round     = 4;
 
+	m2->simd = &multi2::kernel::select();
+
 	MULTI2 *r = static_cast<MULTI2 *>(m2);
 	r->private_data = m2;
 
@@ -142,14 +191,67 @@ ARIB25_API_EXPORT MULTI2 *create_multi2()
 	r->clear_scramble_key = clear_scramble_key_multi2;
 	r->encrypt            = encrypt_multi2;
 	r->decrypt            = decrypt_multi2;
+	r->encrypt_batch      = encrypt_batch_multi2;
+	r->decrypt_batch      = decrypt_batch_multi2;
 
 	return r;
 }
 
-/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- function prottypes (private method)
- ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
-static multi2::multi2 *private_data(void *m2);
+ARIB25_API_EXPORT int rekey_multi2(MULTI2 **m2, int32_t count)
+{
+	typedef std::pair<multi2::multi2 *, int> slot;
+
+	if (count < 0 || (0 < count && !m2)) {
+		return MULTI2_ERROR_INVALID_PARAMETER;
+	}
+
+	try {
+		std::vector<slot> s;
+		for (int32_t j = 0; j < count; ++j) {
+			multi2::multi2 *prv = private_data(m2[j]);
+			if (!prv) {
+				return MULTI2_ERROR_INVALID_PARAMETER;
+			}
+			for (int i = 0; i < 2; ++i) {
+				if (prv->pending(i)) {
+					s.push_back(slot(prv, i));
+				}
+			}
+		}
+
+		/* one pass per distinct system key, normally all of them share one */
+		std::vector<multi2::data_key_type> dk;
+		std::vector<multi2::work_key_type> wk;
+		std::vector<slot> g;
+		while (!s.empty()) {
+			multi2::system_key_type sk = *s[0].first->system_key;
+
+			dk.clear();
+			g.clear();
+			for (size_t j = 0; j < s.size(); ) {
+				if (*s[j].first->system_key != sk) {
+					++j;
+					continue;
+				}
+				dk.push_back(*s[j].first->data_key[s[j].second]);
+				g.push_back(s[j]);
+				s[j] = s.back();
+				s.pop_back();
+			}
+
+			wk.resize(dk.size());
+			g[0].first->simd->schedule_many(&dk[0][0], dk.size(), &sk[0], &wk[0][0]);
+
+			for (size_t j = 0; j < g.size(); ++j) {
+				g[j].first->set_work_key(g[j].second, wk[j]);
+			}
+		}
+	} catch (std::bad_alloc &e) {
+		return MULTI2_ERROR_NO_ENOUGH_MEMORY;
+	}
+
+	return 0;
+}
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  interface method implementation
@@ -253,6 +355,26 @@ static int decrypt_multi2(void *m2, int32_t type, uint8_t *buf, int32_t size)
 	return prv->decrypt(type, buf, size);
 }
 
+static int encrypt_batch_multi2(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count)
+{
+	multi2::multi2 *prv = private_data(m2);
+	if (!prv || !check_batch(type, buf, size, count)) {
+		return MULTI2_ERROR_INVALID_PARAMETER;
+	}
+
+	return prv->crypt_batch(prv->simd->encrypt_batch, type, buf, size, count);
+}
+
+static int decrypt_batch_multi2(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count)
+{
+	multi2::multi2 *prv = private_data(m2);
+	if (!prv || !check_batch(type, buf, size, count)) {
+		return MULTI2_ERROR_INVALID_PARAMETER;
+	}
+
+	return prv->crypt_batch(prv->simd->decrypt_batch, type, buf, size, count);
+}
+
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  private method implementation
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
@@ -269,3 +391,18 @@ static multi2::multi2 *private_data(void *m2)
 
 	return r;
 }
+
+static bool check_batch(const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count)
+{
+	if (count < 0 || (0 < count && (!type || !buf || !size))) {
+		return false;
+	}
+
+	for (int32_t i = 0; i < count; ++i) {
+		if (!buf[i] || size[i] < 1) {
+			return false;
+		}
+	}
+
+	return true;
+}
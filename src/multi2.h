@@ -21,6 +21,9 @@ typedef struct {
 	int (* encrypt)(void *m2, int32_t type, uint8_t *buf, int32_t size);
 	int (* decrypt)(void *m2, int32_t type, uint8_t *buf, int32_t size);
 
+	int (* encrypt_batch)(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count);
+	int (* decrypt_batch)(void *m2, const int32_t *type, uint8_t **buf, const int32_t *size, int32_t count);
+
 } MULTI2;
 
 #ifdef __cplusplus
@@ -29,6 +32,10 @@ extern "C" {
 
 extern ARIB25_API_EXPORT MULTI2 *create_multi2();
 
+/* schedules every work key left pending by set_scramble_key() across
+   count instances in one batch, e.g. right after a burst of ECM replies */
+extern ARIB25_API_EXPORT int rekey_multi2(MULTI2 **m2, int32_t count);
+
 #ifdef __cplusplus
 }
 #endif
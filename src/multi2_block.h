@@ -63,6 +63,17 @@ inline std::pair<block<uint32_t>, cbc_state> block<uint32_t>::cbc_post_decrypt(c
 	return std::make_pair(p, c);
 }
 
+/*
+ * T with every lane set to p[0], p must repeat the value at least as many
+ * times as T has lanes. vector types load the copies instead of broadcasting.
+ */
+template<typename T>
+struct lanes {
+	static inline T load(const uint32_t *p) {
+		return T(*p);
+	}
+};
+
 template<size_t N, typename T>
 inline T rot(const T &v) {
 	return (v << N) | (v >> (32 - N));
@@ -5,11 +5,14 @@
 #include "portable.h"
 
 #include "multi2_block.h"
+#include "multi2_zmm.h"
 #include "multi2_ymm2.h"
 #include "multi2_ymm.h"
 #include "multi2_xmm.h"
+#include "multi2_sve.h"
 #include "multi2_neon2.h"
 #include "multi2_neon.h"
+#include "multi2_rvv.h"
 
 #if defined(__GNUC__) || defined(__clang__)
 # define MULTI2_ALWAYS_INLINE __attribute__((always_inline))
@@ -26,6 +29,33 @@ typedef array<uint32_t, 2> iv_type;
 typedef array<uint32_t, 2> data_key_type;
 typedef array<uint32_t, 8> work_key_type;
 
+/*
+ * work key with every word repeated over 16 lanes. the leading lanes of a
+ * row are the ready made broadcast of that word for any block type up to
+ * 512 bits, so the vector paths load their keys instead of splatting them.
+ */
+typedef array<array<uint32_t, 16>, 8> wide_key_type;
+
+inline wide_key_type widen(const work_key_type &k) {
+	wide_key_type w;
+	for (size_t i = 0; i < 8; ++i) {
+		for (size_t j = 0; j < 16; ++j) {
+			w[i][j] = k[i];
+		}
+	}
+	return w;
+}
+
+template<typename T>
+MULTI2_ALWAYS_INLINE
+inline array<T, 8> round_keys(const wide_key_type &w) {
+	array<T, 8> k;
+	for (size_t i = 0; i < 8; ++i) {
+		k[i] = lanes<T>::load(&w[i][0]);
+	}
+	return k;
+}
+
 template<typename T>
 struct pi {
 	typedef block<T> block_type;
@@ -34,68 +64,127 @@ struct pi {
 		return block_type(p.left, p.right ^ p.left);
 	}
 
-	static inline block_type pi2(const block_type &p, uint32_t k1) {
+	static inline block_type pi2(const block_type &p, const T &k1) {
 		T x = p.right;
-		T y = x + T(k1);
+		T y = x + k1;
 		T z = rot1_add_dec(y);
 		return block_type(p.left ^ rot<4>(z) ^ z, p.right);
 	}
 
-	static inline block_type pi3(const block_type &p, uint32_t k2, uint32_t k3) {
+	static inline block_type pi3(const block_type &p, const T &k2, const T &k3) {
 		T x = p.left;
-		T y = x + T(k2);
+		T y = x + k2;
 		T z = rot<2>(y) + y + T(1);
 		T a = rot<8>(z) ^ z;
-		T b = a + T(k3);
+		T b = a + k3;
 		T c = rot1_sub(b);
 		return block_type(p.left, p.right ^ rot<16>(c) ^ (c | x));
 	}
 
-	static inline block_type pi4(const block_type &p, uint32_t k4) {
+	static inline block_type pi4(const block_type &p, const T &k4) {
 		T x = p.right;
-		T y = x + T(k4);
+		T y = x + k4;
 		return block_type(p.left ^ (rot<2>(y) + y + T(1)), p.right);
 	}
 };
 
-template<typename T>
+/*
+ * R == 0 runs the round count given at run time, any other R runs
+ * exactly R rounds fully unrolled and ignores the run time count.
+ */
+template<typename T, int R = 0>
 struct cipher {
 	typedef block<T> block_type;
+	typedef array<T, 8> key_type;
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type encrypt(const block_type &b, const key_type &wk, int) {
+		return cipher<T, R - 1>::encrypt(cipher<T>::encrypt_round(b, wk), wk, R - 1);
+	}
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type decrypt(const block_type &b, const key_type &wk, int) {
+		return cipher<T, R - 1>::decrypt(cipher<T>::decrypt_round(b, wk), wk, R - 1);
+	}
+};
+
+template<typename T>
+struct cipher<T, 0> {
+	typedef block<T> block_type;
+	typedef array<T, 8> key_type;
 	typedef pi<T> p;
 
-	static inline block_type encrypt(const block_type &b, const work_key_type &wk, int n) {
+	MULTI2_ALWAYS_INLINE
+	static inline block_type encrypt_round(const block_type &b, const key_type &wk) {
+		block_type t = b;
+
+		t = p::pi1(t);
+		t = p::pi2(t, wk[0]);
+		t = p::pi3(t, wk[1], wk[2]);
+		t = p::pi4(t, wk[3]);
+		t = p::pi1(t);
+		t = p::pi2(t, wk[4]);
+		t = p::pi3(t, wk[5], wk[6]);
+		t = p::pi4(t, wk[7]);
+		return t;
+	}
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type decrypt_round(const block_type &b, const key_type &wk) {
+		block_type t = b;
+
+		t = p::pi4(t, wk[7]);
+		t = p::pi3(t, wk[5], wk[6]);
+		t = p::pi2(t, wk[4]);
+		t = p::pi1(t);
+		t = p::pi4(t, wk[3]);
+		t = p::pi3(t, wk[1], wk[2]);
+		t = p::pi2(t, wk[0]);
+		t = p::pi1(t);
+		return t;
+	}
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type encrypt(const block_type &b, const key_type &wk, int n) {
 		block_type t = b;
 
 		for (int i = 0; i < n; ++i) {
-			t = p::pi1(t);
-			t = p::pi2(t, wk[0]);
-			t = p::pi3(t, wk[1], wk[2]);
-			t = p::pi4(t, wk[3]);
-			t = p::pi1(t);
-			t = p::pi2(t, wk[4]);
-			t = p::pi3(t, wk[5], wk[6]);
-			t = p::pi4(t, wk[7]);
+			t = encrypt_round(t, wk);
 		}
 		return t;
 	}
 
-	static inline block_type decrypt(const block_type &b, const work_key_type &wk, int n) {
+	MULTI2_ALWAYS_INLINE
+	static inline block_type decrypt(const block_type &b, const key_type &wk, int n) {
 		block_type t = b;
 
 		for (int i = 0; i < n; ++i) {
-			t = p::pi4(t, wk[7]);
-			t = p::pi3(t, wk[5], wk[6]);
-			t = p::pi2(t, wk[4]);
-			t = p::pi1(t);
-			t = p::pi4(t, wk[3]);
-			t = p::pi3(t, wk[1], wk[2]);
-			t = p::pi2(t, wk[0]);
-			t = p::pi1(t);
+			t = decrypt_round(t, wk);
 		}
 		return t;
 	}
 };
 
+template<typename T>
+struct cipher<T, 1> {
+	typedef block<T> block_type;
+	typedef array<T, 8> key_type;
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type encrypt(const block_type &b, const key_type &wk, int) {
+		return cipher<T>::encrypt_round(b, wk);
+	}
+
+	MULTI2_ALWAYS_INLINE
+	static inline block_type decrypt(const block_type &b, const key_type &wk, int) {
+		return cipher<T>::decrypt_round(b, wk);
+	}
+};
+
+/* the round count ARIB STD-B25 actually uses, worth a fully unrolled copy */
+enum {
+	COMMON_ROUND = 4,
+};
 
 inline work_key_type schedule(const data_key_type &dk, const system_key_type &sk) {
 	typedef pi<uint32_t> p;
@@ -123,6 +212,119 @@ inline work_key_type schedule(const data_key_type &dk, const system_key_type &sk
 	return w;
 }
 
+/*
+ * schedule() for many data keys under one system key.
+ *
+ * data keys are laid out as 8 byte blocks in k[0], so the key schedule
+ * runs through the same block types as the cipher with as many keys per
+ * pass as the widest one holds. each block of k[0] is replaced by work
+ * key words 0-1 and the same block of k[1], k[2], k[3] receives words
+ * 2-3, 4-5 and 6-7.
+ */
+template<typename T>
+MULTI2_ALWAYS_INLINE
+static inline void schedule_block(uint8_t *const *k, size_t &x, size_t &n, const system_key_type &sk) {
+	typedef pi<T> p;
+
+	block<T> d;
+	d.load(k[0] + x);
+
+	block<T> a0 = p::pi1(d);
+	block<T> a1 = p::pi2(a0, sk[0]);
+	block<T> a2 = p::pi3(a1, sk[1], sk[2]);
+	block<T> a3 = p::pi4(a2, sk[3]);
+	block<T> a4 = p::pi1(a3);
+	block<T> a5 = p::pi2(a4, sk[4]);
+	block<T> a6 = p::pi3(a5, sk[5], sk[6]);
+	block<T> a7 = p::pi4(a6, sk[7]);
+	block<T> a8 = p::pi1(a7);
+
+	block<T>(a1.left, a2.right).store(k[0] + x);
+	block<T>(a3.left, a4.right).store(k[1] + x);
+	block<T>(a5.left, a6.right).store(k[2] + x);
+	block<T>(a7.left, a8.right).store(k[3] + x);
+
+	x += block_size<T>();
+	n -= block_size<T>();
+}
+
+inline void schedule_blocks(uint8_t *const *k, size_t n, const system_key_type &sk) {
+	size_t x = 0;
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+	while (block_size<x86::zmm<16> >() <= n) {
+		schedule_block<x86::zmm<16> >(k, x, n, sk);
+	}
+	if (block_size<x86::ymm>() <= n) {
+		schedule_block<x86::ymm>(k, x, n, sk);
+	}
+#if defined(__SSE2__)
+	if (block_size<x86::xmm>() <= n) {
+		schedule_block<x86::xmm>(k, x, n, sk);
+	}
+#endif
+
+#elif defined(__AVX2__)
+	while (block_size<x86::ymm2>() <= n) {
+		schedule_block<x86::ymm2>(k, x, n, sk);
+	}
+	if (block_size<x86::ymm>() <= n) {
+		schedule_block<x86::ymm>(k, x, n, sk);
+	}
+#if defined(__SSE2__)
+	if (block_size<x86::xmm>() <= n) {
+		schedule_block<x86::xmm>(k, x, n, sk);
+	}
+#endif
+
+#elif defined(__SSE2__)
+	while (block_size<x86::xmm>() <= n) {
+		schedule_block<x86::xmm>(k, x, n, sk);
+	}
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+	while (block_size<arm::neon2<8> >() <= n) {
+		schedule_block<arm::neon2<8> >(k, x, n, sk);
+	}
+	if (block_size<arm::neon>() <= n) {
+		schedule_block<arm::neon>(k, x, n, sk);
+	}
+
+#endif
+
+	while (block_size<uint32_t>() <= n) {
+		schedule_block<uint32_t>(k, x, n, sk);
+	}
+}
+
+inline void schedule_many(const data_key_type *dk, size_t count, const system_key_type &sk, work_key_type *wk) {
+
+	enum {
+		STAGE_KEYS = 64,
+	};
+
+	array<array<uint8_t, STAGE_KEYS * 8>, 4> k;
+	uint8_t *r[4] = { &k[0][0], &k[1][0], &k[2][0], &k[3][0] };
+
+	for (size_t first = 0; first < count; first += STAGE_KEYS) {
+		size_t m = (count - first < STAGE_KEYS) ? count - first : STAGE_KEYS;
+
+		for (size_t i = 0; i < m; ++i) {
+			store_be(&k[0][i * 8],     dk[first + i][0]);
+			store_be(&k[0][i * 8 + 4], dk[first + i][1]);
+		}
+
+		schedule_blocks(r, m * 8, sk);
+
+		for (size_t i = 0; i < m; ++i) {
+			for (size_t j = 0; j < 4; ++j) {
+				wk[first + i][j * 2]     = load_be(&k[j][i * 8]);
+				wk[first + i][j * 2 + 1] = load_be(&k[j][i * 8 + 4]);
+			}
+		}
+	}
+}
+
 inline void encrypt_cbc_ofb(uint8_t *buf, size_t n, const iv_type &iv, const work_key_type &key, int round) {
 
 	cbc_state state(iv[0], iv[1]);
@@ -152,13 +354,13 @@ inline void encrypt_cbc_ofb(uint8_t *buf, size_t n, const iv_type &iv, const wor
 	}
 }
 
-template<typename T>
+template<typename T, int R>
 MULTI2_ALWAYS_INLINE
-static inline void decrypt_block(uint8_t *&buf, size_t &n, cbc_state &state, const work_key_type &key, int round) {
+static inline void decrypt_block(uint8_t *&buf, size_t &n, cbc_state &state, const wide_key_type &key, int round) {
 	block<T> c;
 	c.load(buf);
 
-	block<T> d = cipher<T>::decrypt(c, key, round);
+	block<T> d = cipher<T, R>::decrypt(c, round_keys<T>(key), round);
 	std::pair<block<T>, cbc_state> ps = d.cbc_post_decrypt(c, state);
 	ps.first.store(buf);
 
@@ -167,51 +369,78 @@ static inline void decrypt_block(uint8_t *&buf, size_t &n, cbc_state &state, con
 	n   -= block_size<T>();
 }
 
-inline void decrypt_cbc_ofb(uint8_t *buf, size_t n, const iv_type &iv, const work_key_type &key, int round) {
+template<int R>
+inline void decrypt_cbc_ofb_rounds(uint8_t *buf, size_t n, const iv_type &iv, const wide_key_type &key, int round) {
 
 	cbc_state state(iv[0], iv[1]);
 
-#if defined(__AVX2__)
+#if defined(__AVX512F__) && defined(__AVX512BW__)
 	if (MULTI2_LIKELY(n == 184)) {
-		decrypt_block<x86::ymm2>(buf, n, state, key, round);
-		decrypt_block<x86::ymm>(buf, n, state, key, round);
+		decrypt_block<x86::zmm2<23>, R>(buf, n, state, key, round);
+		return;
+	}
+	while (block_size<x86::zmm2<32> >() <= n) {
+		decrypt_block<x86::zmm2<32>, R>(buf, n, state, key, round);
+	}
+	if (block_size<x86::zmm<16> >() <= n) {
+		decrypt_block<x86::zmm<16>, R>(buf, n, state, key, round);
+	}
+	if (block_size<x86::ymm>() <= n) {
+		decrypt_block<x86::ymm, R>(buf, n, state, key, round);
+	}
+#if defined(__SSE2__)
+	if (block_size<x86::xmm>() <= n) {
+		decrypt_block<x86::xmm, R>(buf, n, state, key, round);
+	}
+#endif
+
+#elif defined(__AVX2__)
+	if (MULTI2_LIKELY(n == 184)) {
+		decrypt_block<x86::ymm2, R>(buf, n, state, key, round);
+		decrypt_block<x86::ymm, R>(buf, n, state, key, round);
 		return;
 	}
 	if (block_size<x86::ymm2>() <= n) {
-		decrypt_block<x86::ymm2>(buf, n, state, key, round);
+		decrypt_block<x86::ymm2, R>(buf, n, state, key, round);
 	}
 	if (block_size<x86::ymm>() <= n) {
-		decrypt_block<x86::ymm>(buf, n, state, key, round);
+		decrypt_block<x86::ymm, R>(buf, n, state, key, round);
 	}
 #if defined(__SSE2__)
 	if (block_size<x86::xmm>() <= n) {
-		decrypt_block<x86::xmm>(buf, n, state, key, round);
+		decrypt_block<x86::xmm, R>(buf, n, state, key, round);
 	}
 #endif
 
 #elif defined(__SSE2__)
 	while (block_size<x86::xmm>() <= n) {
-		decrypt_block<x86::xmm>(buf, n, state, key, round);
+		decrypt_block<x86::xmm, R>(buf, n, state, key, round);
 	}
 
+#elif defined(__ARM_FEATURE_SVE)
+	arm::sve::decrypt_cbc<R>(buf, n, state, round_keys<uint32_t>(key), round);
+
 #elif defined(__ARM_NEON__) || defined(__ARM_NEON)
 	if (MULTI2_LIKELY(n == 184)) {
-		decrypt_block<arm::neon2<7> >(buf, n, state, key, round);
-		decrypt_block<arm::neon2<8> >(buf, n, state, key, round);
-		decrypt_block<arm::neon2<8> >(buf, n, state, key, round);
+		decrypt_block<arm::neon2<7>, R>(buf, n, state, key, round);
+		decrypt_block<arm::neon2<8>, R>(buf, n, state, key, round);
+		decrypt_block<arm::neon2<8>, R>(buf, n, state, key, round);
 		return;
 	}
 	while (block_size<arm::neon2<8> >() <= n) {
-		decrypt_block<arm::neon2<8> >(buf, n, state, key, round);
+		decrypt_block<arm::neon2<8>, R>(buf, n, state, key, round);
 	}
 	if (block_size<arm::neon>() <= n) {
-		decrypt_block<arm::neon>(buf, n, state, key, round);
+		decrypt_block<arm::neon, R>(buf, n, state, key, round);
 	}
 
+#elif defined(__riscv_v_intrinsic) && (__riscv_v_intrinsic >= 12000)
+	riscv::rvv::decrypt_cbc<R>(buf, n, state, round_keys<uint32_t>(key), round);
+
 #endif
 
 	while (block_size<uint32_t>() <= n) {
-		decrypt_block<uint32_t>(buf, n, state, key, round);
+		decrypt_block<uint32_t, R>(buf, n, state, key, round);
 	}
 	if (0 < n) {
 		array<uint8_t, 8> t;
@@ -221,12 +450,265 @@ inline void decrypt_cbc_ofb(uint8_t *buf, size_t n, const iv_type &iv, const wor
 		block<uint32_t> c;
 		c.load(&t[0]);
 
-		block<uint32_t> p = c ^ cipher<uint32_t>::encrypt(state, key, round);
+		block<uint32_t> p = c ^ cipher<uint32_t, R>::encrypt(state, round_keys<uint32_t>(key), round);
 		p.store(&t[0]);
 		memcpy(buf, &t[0], n);
 	}
 }
 
+inline void decrypt_cbc_ofb(uint8_t *buf, size_t n, const iv_type &iv, const wide_key_type &key, int round) {
+	if (MULTI2_LIKELY(round == COMMON_ROUND)) {
+		decrypt_cbc_ofb_rounds<COMMON_ROUND>(buf, n, iv, key, round);
+	} else {
+		decrypt_cbc_ofb_rounds<0>(buf, n, iv, key, round);
+	}
+}
+
+template<typename T, bool Encrypt, int R>
+MULTI2_ALWAYS_INLINE
+static inline void ecb_block(uint8_t *&buf, size_t &n, const wide_key_type &key, int round) {
+	block<T> b;
+	b.load(buf);
+
+	array<T, 8> k = round_keys<T>(key);
+	b = Encrypt ? cipher<T, R>::encrypt(b, k, round) : cipher<T, R>::decrypt(b, k, round);
+	b.store(buf);
+
+	buf += block_size<T>();
+	n   -= block_size<T>();
+}
+
+/* independent blocks, n must be a multiple of 8 */
+template<bool Encrypt, int R>
+inline void crypt_ecb_rounds(uint8_t *buf, size_t n, const wide_key_type &key, int round) {
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+	while (block_size<x86::zmm2<32> >() <= n) {
+		ecb_block<x86::zmm2<32>, Encrypt, R>(buf, n, key, round);
+	}
+	if (block_size<x86::zmm<16> >() <= n) {
+		ecb_block<x86::zmm<16>, Encrypt, R>(buf, n, key, round);
+	}
+	if (block_size<x86::ymm>() <= n) {
+		ecb_block<x86::ymm, Encrypt, R>(buf, n, key, round);
+	}
+#if defined(__SSE2__)
+	if (block_size<x86::xmm>() <= n) {
+		ecb_block<x86::xmm, Encrypt, R>(buf, n, key, round);
+	}
+#endif
+
+#elif defined(__AVX2__)
+	while (block_size<x86::ymm2>() <= n) {
+		ecb_block<x86::ymm2, Encrypt, R>(buf, n, key, round);
+	}
+	if (block_size<x86::ymm>() <= n) {
+		ecb_block<x86::ymm, Encrypt, R>(buf, n, key, round);
+	}
+#if defined(__SSE2__)
+	if (block_size<x86::xmm>() <= n) {
+		ecb_block<x86::xmm, Encrypt, R>(buf, n, key, round);
+	}
+#endif
+
+#elif defined(__SSE2__)
+	while (block_size<x86::xmm>() <= n) {
+		ecb_block<x86::xmm, Encrypt, R>(buf, n, key, round);
+	}
+
+#elif defined(__ARM_FEATURE_SVE)
+	arm::sve::crypt_ecb<Encrypt, R>(buf, n, round_keys<uint32_t>(key), round);
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+	while (block_size<arm::neon2<8> >() <= n) {
+		ecb_block<arm::neon2<8>, Encrypt, R>(buf, n, key, round);
+	}
+	if (block_size<arm::neon>() <= n) {
+		ecb_block<arm::neon, Encrypt, R>(buf, n, key, round);
+	}
+
+#elif defined(__riscv_v_intrinsic) && (__riscv_v_intrinsic >= 12000)
+	riscv::rvv::crypt_ecb<Encrypt, R>(buf, n, round_keys<uint32_t>(key), round);
+
+#endif
+
+	while (block_size<uint32_t>() <= n) {
+		ecb_block<uint32_t, Encrypt, R>(buf, n, key, round);
+	}
+}
+
+template<bool Encrypt>
+inline void crypt_ecb(uint8_t *buf, size_t n, const wide_key_type &key, int round) {
+	if (MULTI2_LIKELY(round == COMMON_ROUND)) {
+		crypt_ecb_rounds<Encrypt, COMMON_ROUND>(buf, n, key, round);
+	} else {
+		crypt_ecb_rounds<Encrypt, 0>(buf, n, key, round);
+	}
+}
+
+/*
+ * decrypt_cbc_ofb() over many independent payloads sharing one key.
+ *
+ * full blocks of up to 64 TS payloads are gathered into one staging buffer
+ * and the OFB keystream inputs of their residual tails into another, so
+ * that both go through the cipher at full vector width instead of one
+ * short, partially filled run per payload. the CBC chaining and the tail
+ * XOR are applied while scattering the result back.
+ */
+inline void decrypt_cbc_ofb_batch(uint8_t *const *buf, const int32_t *len, size_t count, const iv_type &iv, const wide_key_type &key, int round) {
+
+	enum {
+		STAGE_PACKETS = 64,
+		STAGE_BYTES   = STAGE_PACKETS * 184,
+	};
+
+	array<uint8_t, STAGE_BYTES> d;
+	array<uint8_t, STAGE_PACKETS * 8> k;
+	array<uint8_t, 8> v;
+
+	store_be(&v[0], iv[0]);
+	store_be(&v[4], iv[1]);
+
+	size_t i = 0;
+	while (i < count) {
+		size_t first = i;
+		size_t nd = 0;
+		size_t nk = 0;
+
+		for (; i < count && i - first < STAGE_PACKETS; ++i) {
+			size_t n = len[i];
+			size_t full = n & ~static_cast<size_t>(7);
+			if (STAGE_BYTES < full) {
+				/* too long to stage, fall back to the per-payload path */
+				decrypt_cbc_ofb(buf[i], n, iv, key, round);
+				continue;
+			}
+			if (STAGE_BYTES < nd + full) {
+				break;
+			}
+			memcpy(&d[nd], buf[i], full);
+			nd += full;
+			if (full < n) {
+				memcpy(&k[nk], (0 < full) ? buf[i] + full - 8 : &v[0], 8);
+				nk += 8;
+			}
+		}
+
+		crypt_ecb<false>(&d[0], nd, key, round);
+		crypt_ecb<true>(&k[0], nk, key, round);
+
+		nd = 0;
+		nk = 0;
+		for (size_t j = first; j < i; ++j) {
+			uint8_t *p = buf[j];
+			size_t n = len[j];
+			size_t full = n & ~static_cast<size_t>(7);
+			if (STAGE_BYTES < full) {
+				continue;
+			}
+			if (full < n) {
+				for (size_t x = full; x < n; ++x) {
+					p[x] ^= k[nk + x - full];
+				}
+				nk += 8;
+			}
+			if (0 < full) {
+				/* p still holds the ciphertext, so chain before copying back */
+				uint8_t *q = &d[nd];
+				for (size_t x = 0; x < 8; ++x) {
+					q[x] ^= v[x];
+				}
+				for (size_t x = 8; x < full; ++x) {
+					q[x] ^= p[x - 8];
+				}
+				memcpy(p, q, full);
+			}
+			nd += full;
+		}
+	}
+}
+
+/*
+ * encrypt_cbc_ofb() over many independent payloads sharing one key.
+ *
+ * CBC encryption is serial within a payload, so up to 64 payloads are
+ * run in lock-step instead: block j of every payload takes one lane of
+ * the staging buffer and the whole step goes through the cipher at once.
+ */
+inline void encrypt_cbc_ofb_batch(uint8_t *const *buf, const int32_t *len, size_t count, const iv_type &iv, const wide_key_type &key, int round) {
+
+	enum {
+		STAGE_PACKETS = 64,
+	};
+
+	array<uint8_t, STAGE_PACKETS * 8> s;
+	array<uint8_t, 8> v;
+
+	store_be(&v[0], iv[0]);
+	store_be(&v[4], iv[1]);
+
+	for (size_t first = 0; first < count; first += STAGE_PACKETS) {
+		size_t last = (count - first < STAGE_PACKETS) ? count : first + STAGE_PACKETS;
+
+		size_t steps = 0;
+		for (size_t i = first; i < last; ++i) {
+			size_t full = static_cast<size_t>(len[i]) & ~static_cast<size_t>(7);
+			if (steps < full) {
+				steps = full;
+			}
+		}
+
+		for (size_t b = 0; b < steps; b += 8) {
+			size_t m = 0;
+			for (size_t i = first; i < last; ++i) {
+				if (static_cast<size_t>(len[i]) < b + 8) {
+					continue;
+				}
+				const uint8_t *c = (0 < b) ? buf[i] + b - 8 : &v[0];
+				for (size_t x = 0; x < 8; ++x) {
+					s[m + x] = buf[i][b + x] ^ c[x];
+				}
+				m += 8;
+			}
+
+			crypt_ecb<true>(&s[0], m, key, round);
+
+			m = 0;
+			for (size_t i = first; i < last; ++i) {
+				if (static_cast<size_t>(len[i]) < b + 8) {
+					continue;
+				}
+				memcpy(buf[i] + b, &s[m], 8);
+				m += 8;
+			}
+		}
+
+		size_t m = 0;
+		for (size_t i = first; i < last; ++i) {
+			size_t n = len[i];
+			size_t full = n & ~static_cast<size_t>(7);
+			if (full < n) {
+				memcpy(&s[m], (0 < full) ? buf[i] + full - 8 : &v[0], 8);
+				m += 8;
+			}
+		}
+
+		crypt_ecb<true>(&s[0], m, key, round);
+
+		m = 0;
+		for (size_t i = first; i < last; ++i) {
+			size_t n = len[i];
+			size_t full = n & ~static_cast<size_t>(7);
+			if (full < n) {
+				for (size_t x = full; x < n; ++x) {
+					buf[i][x] ^= s[m + x - full];
+				}
+				m += 8;
+			}
+		}
+	}
+}
+
 }
 
 #undef MULTI2_ALWAYS_INLINE
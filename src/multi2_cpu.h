@@ -0,0 +1,158 @@
+#pragma once
+
+#include "portable.h"
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+# define MULTI2_CPU_X86
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#elif defined(__aarch64__) && defined(__linux__)
+# define MULTI2_CPU_AARCH64_LINUX
+# include <sys/auxv.h>
+# include <sys/prctl.h>
+#elif defined(__riscv) && defined(__linux__)
+# define MULTI2_CPU_RISCV_LINUX
+# include <sys/auxv.h>
+#endif
+
+namespace multi2 {
+
+namespace cpu {
+
+enum feature {
+	FEATURE_SSE2     = 0x0001,
+	FEATURE_SSSE3    = 0x0002,
+	FEATURE_SSE41    = 0x0004,
+	FEATURE_AVX2     = 0x0008,
+	FEATURE_AVX512F  = 0x0010,
+	FEATURE_AVX512BW = 0x0020,
+	FEATURE_SVE      = 0x0040,
+	FEATURE_SVE_256  = 0x0080, /* SVE vectors are 256 bits or wider */
+	FEATURE_RVV      = 0x0100,
+	FEATURE_PCLMUL   = 0x0200,
+	FEATURE_PMULL    = 0x0400,
+};
+
+#if defined(MULTI2_CPU_X86)
+
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t r[4]) {
+#if defined(_MSC_VER)
+	int v[4];
+	__cpuidex(v, leaf, subleaf);
+	for (int i = 0; i < 4; ++i) {
+		r[i] = v[i];
+	}
+#else
+	__cpuid_count(leaf, subleaf, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+inline uint64_t xgetbv(uint32_t index) {
+#if defined(_MSC_VER)
+	return _xgetbv(index);
+#else
+	uint32_t eax, edx;
+	__asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(index));
+	return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+inline uint32_t features() {
+	uint32_t r[4];
+	uint32_t f = 0;
+
+	cpuid(0, 0, r);
+	uint32_t max_leaf = r[0];
+	if (max_leaf < 1) {
+		return f;
+	}
+
+	cpuid(1, 0, r);
+	if (r[3] & (1u << 26)) {
+		f |= FEATURE_SSE2;
+	}
+	if (r[2] & (1u << 9)) {
+		f |= FEATURE_SSSE3;
+	}
+	if (r[2] & (1u << 19)) {
+		f |= FEATURE_SSE41;
+	}
+	if (r[2] & (1u << 1)) {
+		f |= FEATURE_PCLMUL;
+	}
+
+	/* AVX state must be enabled by the OS (OSXSAVE + XCR0 bits 1 and 2),
+	   AVX-512 additionally needs opmask and ZMM state (XCR0 bits 5 to 7) */
+	bool ymm_state = false;
+	bool zmm_state = false;
+	if ((r[2] & (1u << 27)) && (r[2] & (1u << 28))) {
+		uint64_t xcr0 = xgetbv(0);
+		ymm_state = (xcr0 & 0x06) == 0x06;
+		zmm_state = (xcr0 & 0xe6) == 0xe6;
+	}
+
+	if (ymm_state && 7 <= max_leaf) {
+		cpuid(7, 0, r);
+		if (r[1] & (1u << 5)) {
+			f |= FEATURE_AVX2;
+		}
+		if (zmm_state && (r[1] & (1u << 16))) {
+			f |= FEATURE_AVX512F;
+		}
+		if (zmm_state && (r[1] & (1u << 30))) {
+			f |= FEATURE_AVX512BW;
+		}
+	}
+
+	return f;
+}
+
+#elif defined(MULTI2_CPU_AARCH64_LINUX)
+
+inline uint32_t features() {
+	uint32_t f = 0;
+
+	if (getauxval(AT_HWCAP) & (1ul << 4)) { /* HWCAP_PMULL */
+		f |= FEATURE_PMULL;
+	}
+
+	if (getauxval(AT_HWCAP) & (1ul << 22)) { /* HWCAP_SVE */
+		f |= FEATURE_SVE;
+
+		/* PR_SVE_GET_VL, vector length in bytes in the low 16 bits */
+		int vl = prctl(51, 0, 0, 0, 0);
+		if (0 < vl && 32 <= (vl & 0xffff)) {
+			f |= FEATURE_SVE_256;
+		}
+	}
+
+	return f;
+}
+
+#elif defined(MULTI2_CPU_RISCV_LINUX)
+
+inline uint32_t features() {
+	uint32_t f = 0;
+
+	/* single letter extensions are reported as bit (letter - 'A') */
+	if (getauxval(AT_HWCAP) & (1ul << ('V' - 'A'))) {
+		f |= FEATURE_RVV;
+	}
+
+	return f;
+}
+
+#else /* MULTI2_CPU_X86 */
+
+inline uint32_t features() {
+	return 0;
+}
+
+#endif /* MULTI2_CPU_X86 */
+
+}
+
+}
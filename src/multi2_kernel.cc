@@ -0,0 +1,40 @@
+#define MULTI2_KERNEL_NAMESPACE multi2
+#define MULTI2_KERNEL_TABLE generic
+#include "multi2_kernel_impl.inc"
+
+#include "multi2_cpu.h"
+
+const multi2::kernel::functions &multi2::kernel::select()
+{
+	uint32_t f = cpu::features();
+
+#if defined(MULTI2_KERNEL_AVX512)
+	if ((f & cpu::FEATURE_AVX512F) && (f & cpu::FEATURE_AVX512BW)) {
+		return avx512;
+	}
+#endif
+#if defined(MULTI2_KERNEL_AVX2)
+	if (f & cpu::FEATURE_AVX2) {
+		return avx2;
+	}
+#endif
+#if defined(MULTI2_KERNEL_SSE41)
+	if ((f & cpu::FEATURE_SSSE3) && (f & cpu::FEATURE_SSE41)) {
+		return sse41;
+	}
+#endif
+#if defined(MULTI2_KERNEL_SVE)
+	/* at 128 bits NEON already covers the same width, with two registers in flight */
+	if ((f & cpu::FEATURE_SVE) && (f & cpu::FEATURE_SVE_256)) {
+		return sve;
+	}
+#endif
+#if defined(MULTI2_KERNEL_RVV)
+	if (f & cpu::FEATURE_RVV) {
+		return rvv;
+	}
+#endif
+
+	(void)f;
+	return generic;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+#include "portable.h"
+
+namespace multi2 {
+
+namespace kernel {
+
+/*
+ * cipher entry points compiled for a particular instruction set.
+ *
+ * every variant lives in its own translation unit built with its own
+ * code generation flags, and is picked by select() from what the
+ * running CPU supports.
+ *
+ * key is the work key widened by widen(), 8 rows of 16 copies of each
+ * word, built once per key by the caller. schedule_many takes count data
+ * keys of 2 words and writes count work keys of 8 words.
+ */
+typedef void (*decrypt_cbc_ofb_type)(uint8_t *buf, size_t n, const uint32_t *iv, const uint32_t *key, int round);
+typedef void (*crypt_batch_type)(uint8_t *const *buf, const int32_t *len, size_t count, const uint32_t *iv, const uint32_t *key, int round);
+typedef void (*schedule_many_type)(const uint32_t *dk, size_t count, const uint32_t *sk, uint32_t *wk);
+
+struct functions {
+	decrypt_cbc_ofb_type decrypt_cbc_ofb;
+	crypt_batch_type     decrypt_batch;
+	crypt_batch_type     encrypt_batch;
+	schedule_many_type   schedule_many;
+};
+
+extern const functions generic;
+#if defined(MULTI2_KERNEL_SSE41)
+extern const functions sse41;
+#endif
+#if defined(MULTI2_KERNEL_AVX2)
+extern const functions avx2;
+#endif
+#if defined(MULTI2_KERNEL_AVX512)
+extern const functions avx512;
+#endif
+#if defined(MULTI2_KERNEL_SVE)
+extern const functions sve;
+#endif
+#if defined(MULTI2_KERNEL_RVV)
+extern const functions rvv;
+#endif
+
+const functions &select();
+
+}
+
+}
@@ -0,0 +1,3 @@
+#define MULTI2_KERNEL_NAMESPACE multi2_avx2
+#define MULTI2_KERNEL_TABLE avx2
+#include "multi2_kernel_impl.inc"
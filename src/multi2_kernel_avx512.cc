@@ -0,0 +1,3 @@
+#define MULTI2_KERNEL_NAMESPACE multi2_avx512
+#define MULTI2_KERNEL_TABLE avx512
+#include "multi2_kernel_impl.inc"
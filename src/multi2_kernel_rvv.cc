@@ -0,0 +1,3 @@
+#define MULTI2_KERNEL_NAMESPACE multi2_rvv
+#define MULTI2_KERNEL_TABLE rvv
+#include "multi2_kernel_impl.inc"
@@ -0,0 +1,3 @@
+#define MULTI2_KERNEL_NAMESPACE multi2_sse41
+#define MULTI2_KERNEL_TABLE sse41
+#include "multi2_kernel_impl.inc"
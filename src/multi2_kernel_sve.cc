@@ -0,0 +1,3 @@
+#define MULTI2_KERNEL_NAMESPACE multi2_sve
+#define MULTI2_KERNEL_TABLE sve
+#include "multi2_kernel_impl.inc"
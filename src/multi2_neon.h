@@ -41,6 +41,13 @@ public:
 
 }
 
+template<>
+struct lanes<arm::neon> {
+	static inline arm::neon load(const uint32_t *p) {
+		return vld1q_u32(p);
+	}
+};
+
 template<>
 inline void block<arm::neon>::load(const uint8_t *p) {
 	const uint32_t *q = reinterpret_cast<const uint32_t *>(p);
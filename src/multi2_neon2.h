@@ -118,6 +118,14 @@ public:
 
 }
 
+template<size_t S>
+struct lanes<arm::neon2<S> > {
+	static inline arm::neon2<S> load(const uint32_t *p) {
+		uint32x4_t v = vld1q_u32(p);
+		return arm::neon2<S>(v, v);
+	}
+};
+
 template<>
 inline size_t block_size<arm::neon2<7> >() {
 	return 56;
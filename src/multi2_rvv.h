@@ -0,0 +1,183 @@
+#pragma once
+
+/* intrinsics 0.12 or later, the first with tuple types for segment loads */
+#if defined(__riscv_v_intrinsic) && (__riscv_v_intrinsic >= 12000)
+
+#include <riscv_vector.h>
+
+#include "portable.h"
+
+#include "multi2_block.h"
+
+namespace multi2 {
+
+namespace riscv {
+
+/*
+ * RISC-V vector extension (RVV 1.0) path.
+ *
+ * like SVE the vector types are sizeless and cannot be members of
+ * block<T>, so left and right halves are kept in two LMUL=2 register
+ * groups and pi<T> is mirrored on them. each chunk takes as many blocks
+ * as vsetvl grants, which also shortens the last one of a payload.
+ *
+ * not yet run on hardware or qemu-user, so only built with
+ * USE_RVV_EXPERIMENTAL.
+ */
+namespace rvv {
+
+typedef vuint32m2_t vec;
+
+template<int N>
+inline vec rot(const vec &v, size_t vl) {
+#if defined(__riscv_zvbb)
+	return __riscv_vror_vx_u32m2(v, 32 - N, vl);
+#else
+	return __riscv_vor_vv_u32m2(__riscv_vsll_vx_u32m2(v, N, vl), __riscv_vsrl_vx_u32m2(v, 32 - N, vl), vl);
+#endif
+}
+
+inline void pi1(const vec &l, vec &r, size_t vl) {
+	r = __riscv_vxor_vv_u32m2(r, l, vl);
+}
+
+inline void pi2(vec &l, const vec &r, uint32_t k1, size_t vl) {
+	vec y = __riscv_vadd_vx_u32m2(r, k1, vl);
+	vec z = __riscv_vsub_vx_u32m2(__riscv_vadd_vv_u32m2(rot<1>(y, vl), y, vl), 1, vl);
+	l = __riscv_vxor_vv_u32m2(l, __riscv_vxor_vv_u32m2(rot<4>(z, vl), z, vl), vl);
+}
+
+inline void pi3(const vec &l, vec &r, uint32_t k2, uint32_t k3, size_t vl) {
+	vec y = __riscv_vadd_vx_u32m2(l, k2, vl);
+	vec z = __riscv_vadd_vx_u32m2(__riscv_vadd_vv_u32m2(rot<2>(y, vl), y, vl), 1, vl);
+	vec a = __riscv_vxor_vv_u32m2(rot<8>(z, vl), z, vl);
+	vec b = __riscv_vadd_vx_u32m2(a, k3, vl);
+	vec c = __riscv_vadd_vv_u32m2(b, __riscv_vsrl_vx_u32m2(b, 31, vl), vl);
+	r = __riscv_vxor_vv_u32m2(r, __riscv_vxor_vv_u32m2(rot<16>(c, vl), __riscv_vor_vv_u32m2(c, l, vl), vl), vl);
+}
+
+inline void pi4(vec &l, const vec &r, uint32_t k4, size_t vl) {
+	vec y = __riscv_vadd_vx_u32m2(r, k4, vl);
+	l = __riscv_vxor_vv_u32m2(l, __riscv_vadd_vx_u32m2(__riscv_vadd_vv_u32m2(rot<2>(y, vl), y, vl), 1, vl), vl);
+}
+
+template<typename K>
+inline void encrypt_round(vec &l, vec &r, const K &wk, size_t vl) {
+	pi1(l, r, vl);
+	pi2(l, r, wk[0], vl);
+	pi3(l, r, wk[1], wk[2], vl);
+	pi4(l, r, wk[3], vl);
+	pi1(l, r, vl);
+	pi2(l, r, wk[4], vl);
+	pi3(l, r, wk[5], wk[6], vl);
+	pi4(l, r, wk[7], vl);
+}
+
+template<typename K>
+inline void decrypt_round(vec &l, vec &r, const K &wk, size_t vl) {
+	pi4(l, r, wk[7], vl);
+	pi3(l, r, wk[5], wk[6], vl);
+	pi2(l, r, wk[4], vl);
+	pi1(l, r, vl);
+	pi4(l, r, wk[3], vl);
+	pi3(l, r, wk[1], wk[2], vl);
+	pi2(l, r, wk[0], vl);
+	pi1(l, r, vl);
+}
+
+/* R as in cipher<T, R>: 0 runs the round count given at run time */
+template<int R, bool Encrypt, typename K>
+inline void crypt(vec &l, vec &r, const K &wk, int round, size_t vl) {
+	int n = (R != 0) ? R : round;
+	for (int i = 0; i < n; ++i) {
+		if (Encrypt) {
+			encrypt_round(l, r, wk, vl);
+		} else {
+			decrypt_round(l, r, wk, vl);
+		}
+	}
+}
+
+/* big endian words <-> native, base V has no byte reverse so gather bytes */
+inline vec bswap(const vec &v, size_t vl) {
+#if defined(__riscv_zvbb)
+	return __riscv_vrev8_v_u32m2(v, vl);
+#else
+	size_t bl = vl * 4;
+	vuint16m4_t i = __riscv_vxor_vx_u16m4(__riscv_vid_v_u16m4(bl), 3, bl);
+	vuint8m2_t b = __riscv_vrgatherei16_vv_u8m2(__riscv_vreinterpret_v_u32m2_u8m2(v), i, bl);
+	return __riscv_vreinterpret_v_u8m2_u32m2(b);
+#endif
+}
+
+inline void load(const uint8_t *p, vec &l, vec &r, size_t vl) {
+	vuint32m2x2_t a = __riscv_vlseg2e32_v_u32m2x2(reinterpret_cast<const uint32_t *>(p), vl);
+	l = bswap(__riscv_vget_v_u32m2x2_u32m2(a, 0), vl);
+	r = bswap(__riscv_vget_v_u32m2x2_u32m2(a, 1), vl);
+}
+
+inline void store(uint8_t *p, const vec &l, const vec &r, size_t vl) {
+	vuint32m2x2_t a = __riscv_vundefined_u32m2x2();
+	a = __riscv_vset_v_u32m2_u32m2x2(a, 0, bswap(l, vl));
+	a = __riscv_vset_v_u32m2_u32m2x2(a, 1, bswap(r, vl));
+	__riscv_vsseg2e32_v_u32m2x2(reinterpret_cast<uint32_t *>(p), a, vl);
+}
+
+inline uint32_t last(const vec &v, size_t vl) {
+	return __riscv_vmv_x_s_u32m2_u32(__riscv_vslidedown_vx_u32m2(v, vl - 1, vl));
+}
+
+/* CBC decrypts every full block of buf, leaves the residual tail */
+template<int R, typename K>
+inline void decrypt_cbc(uint8_t *&buf, size_t &n, cbc_state &state, const K &wk, int round) {
+	size_t blocks = n / 8;
+
+	while (0 < blocks) {
+		size_t vl = __riscv_vsetvl_e32m2(blocks);
+
+		vec cl, cr;
+		load(buf, cl, cr, vl);
+
+		vec l = cl;
+		vec r = cr;
+		crypt<R, false>(l, r, wk, round, vl);
+
+		/* lane 0 chains from the previous chunk, lane i from block i-1 */
+		l = __riscv_vxor_vv_u32m2(l, __riscv_vslide1up_vx_u32m2(cl, state.left,  vl), vl);
+		r = __riscv_vxor_vv_u32m2(r, __riscv_vslide1up_vx_u32m2(cr, state.right, vl), vl);
+		state = cbc_state(last(cl, vl), last(cr, vl));
+
+		store(buf, l, r, vl);
+
+		buf    += vl * 8;
+		n      -= vl * 8;
+		blocks -= vl;
+	}
+}
+
+/* independent blocks, n must be a multiple of 8 */
+template<bool Encrypt, int R, typename K>
+inline void crypt_ecb(uint8_t *&buf, size_t &n, const K &wk, int round) {
+	size_t blocks = n / 8;
+
+	while (0 < blocks) {
+		size_t vl = __riscv_vsetvl_e32m2(blocks);
+
+		vec l, r;
+		load(buf, l, r, vl);
+		crypt<R, Encrypt>(l, r, wk, round, vl);
+		store(buf, l, r, vl);
+
+		buf    += vl * 8;
+		n      -= vl * 8;
+		blocks -= vl;
+	}
+}
+
+}
+
+}
+
+}
+
+#endif /* __riscv_v_intrinsic >= 12000 */
@@ -0,0 +1,170 @@
+#pragma once
+
+#if defined(__ARM_FEATURE_SVE)
+
+#include <arm_sve.h>
+
+#include "portable.h"
+
+#include "multi2_block.h"
+
+namespace multi2 {
+
+namespace arm {
+
+/*
+ * vector length agnostic SVE path.
+ *
+ * SVE types are sizeless and cannot be members of block<T>, so the left
+ * and right halves are kept in two registers and pi<T> is mirrored on
+ * them here. lane i holds block i of the current chunk, a chunk is as
+ * many blocks as the hardware has 32-bit lanes and the last one of a
+ * payload is cut short with a predicate.
+ *
+ * key words are splatted from the scalar work key: the vector length is
+ * only known at run time and may exceed the 16 lanes of wide_key_type.
+ */
+namespace sve {
+
+template<int N>
+inline svuint32_t rot(const svuint32_t &v) {
+	svbool_t t = svptrue_b32();
+	if (N == 16) {
+		return svrevh_u32_x(t, v);
+	}
+#if defined(__ARM_FEATURE_SVE2)
+	return svxar_n_u32(v, svdup_n_u32(0), 32 - N);
+#else
+	return svorr_u32_x(t, svlsl_n_u32_x(t, v, N), svlsr_n_u32_x(t, v, 32 - N));
+#endif
+}
+
+inline void pi1(const svuint32_t &l, svuint32_t &r) {
+	r = sveor_u32_x(svptrue_b32(), r, l);
+}
+
+inline void pi2(svuint32_t &l, const svuint32_t &r, uint32_t k1) {
+	svbool_t t = svptrue_b32();
+	svuint32_t y = svadd_n_u32_x(t, r, k1);
+	svuint32_t z = svsub_n_u32_x(t, svadd_u32_x(t, rot<1>(y), y), 1);
+	l = sveor_u32_x(t, l, sveor_u32_x(t, rot<4>(z), z));
+}
+
+inline void pi3(const svuint32_t &l, svuint32_t &r, uint32_t k2, uint32_t k3) {
+	svbool_t t = svptrue_b32();
+	svuint32_t y = svadd_n_u32_x(t, l, k2);
+	svuint32_t z = svadd_n_u32_x(t, svadd_u32_x(t, rot<2>(y), y), 1);
+	svuint32_t a = sveor_u32_x(t, rot<8>(z), z);
+	svuint32_t b = svadd_n_u32_x(t, a, k3);
+	svuint32_t c = svadd_u32_x(t, b, svlsr_n_u32_x(t, b, 31));
+	r = sveor_u32_x(t, r, sveor_u32_x(t, rot<16>(c), svorr_u32_x(t, c, l)));
+}
+
+inline void pi4(svuint32_t &l, const svuint32_t &r, uint32_t k4) {
+	svbool_t t = svptrue_b32();
+	svuint32_t y = svadd_n_u32_x(t, r, k4);
+	l = sveor_u32_x(t, l, svadd_n_u32_x(t, svadd_u32_x(t, rot<2>(y), y), 1));
+}
+
+template<typename K>
+inline void encrypt_round(svuint32_t &l, svuint32_t &r, const K &wk) {
+	pi1(l, r);
+	pi2(l, r, wk[0]);
+	pi3(l, r, wk[1], wk[2]);
+	pi4(l, r, wk[3]);
+	pi1(l, r);
+	pi2(l, r, wk[4]);
+	pi3(l, r, wk[5], wk[6]);
+	pi4(l, r, wk[7]);
+}
+
+template<typename K>
+inline void decrypt_round(svuint32_t &l, svuint32_t &r, const K &wk) {
+	pi4(l, r, wk[7]);
+	pi3(l, r, wk[5], wk[6]);
+	pi2(l, r, wk[4]);
+	pi1(l, r);
+	pi4(l, r, wk[3]);
+	pi3(l, r, wk[1], wk[2]);
+	pi2(l, r, wk[0]);
+	pi1(l, r);
+}
+
+/* R as in cipher<T, R>: 0 runs the round count given at run time */
+template<int R, bool Encrypt, typename K>
+inline void crypt(svuint32_t &l, svuint32_t &r, const K &wk, int round) {
+	int n = (R != 0) ? R : round;
+	for (int i = 0; i < n; ++i) {
+		if (Encrypt) {
+			encrypt_round(l, r, wk);
+		} else {
+			decrypt_round(l, r, wk);
+		}
+	}
+}
+
+inline void load(const svbool_t &pg, const uint8_t *p, svuint32_t &l, svuint32_t &r) {
+	svuint32x2_t a = svld2_u32(pg, reinterpret_cast<const uint32_t *>(p));
+	l = svrevb_u32_x(pg, svget2_u32(a, 0));
+	r = svrevb_u32_x(pg, svget2_u32(a, 1));
+}
+
+inline void store(const svbool_t &pg, uint8_t *p, const svuint32_t &l, const svuint32_t &r) {
+	svuint32x2_t a = svcreate2_u32(svrevb_u32_x(pg, l), svrevb_u32_x(pg, r));
+	svst2_u32(pg, reinterpret_cast<uint32_t *>(p), a);
+}
+
+/* CBC decrypts every full block of buf, leaves the residual tail */
+template<int R, typename K>
+inline void decrypt_cbc(uint8_t *&buf, size_t &n, cbc_state &state, const K &wk, int round) {
+	uint64_t blocks = n / 8;
+	uint64_t lanes = svcntw();
+
+	for (uint64_t i = 0; i < blocks; i += lanes) {
+		svbool_t pg = svwhilelt_b32_u64(i, blocks);
+
+		svuint32_t cl, cr;
+		load(pg, buf + i * 8, cl, cr);
+
+		svuint32_t l = cl;
+		svuint32_t r = cr;
+		crypt<R, false>(l, r, wk, round);
+
+		/* lane 0 chains from the previous chunk, lane i from block i-1 */
+		l = sveor_u32_x(pg, l, svinsr_n_u32(cl, state.left));
+		r = sveor_u32_x(pg, r, svinsr_n_u32(cr, state.right));
+		state = cbc_state(svlastb_u32(pg, cl), svlastb_u32(pg, cr));
+
+		store(pg, buf + i * 8, l, r);
+	}
+
+	buf += blocks * 8;
+	n   -= blocks * 8;
+}
+
+/* independent blocks, n must be a multiple of 8 */
+template<bool Encrypt, int R, typename K>
+inline void crypt_ecb(uint8_t *&buf, size_t &n, const K &wk, int round) {
+	uint64_t blocks = n / 8;
+	uint64_t lanes = svcntw();
+
+	for (uint64_t i = 0; i < blocks; i += lanes) {
+		svbool_t pg = svwhilelt_b32_u64(i, blocks);
+
+		svuint32_t l, r;
+		load(pg, buf + i * 8, l, r);
+		crypt<R, Encrypt>(l, r, wk, round);
+		store(pg, buf + i * 8, l, r);
+	}
+
+	buf += blocks * 8;
+	n   -= blocks * 8;
+}
+
+}
+
+}
+
+}
+
+#endif /* __ARM_FEATURE_SVE */
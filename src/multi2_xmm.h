@@ -48,6 +48,13 @@ public:
 
 }
 
+template<>
+struct lanes<x86::xmm> {
+	static inline x86::xmm load(const uint32_t *p) {
+		return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+	}
+};
+
 #if defined(__SSSE3__)
 
 template<>
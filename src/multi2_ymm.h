@@ -48,6 +48,13 @@ public:
 
 }
 
+template<>
+struct lanes<x86::ymm> {
+	static inline x86::ymm load(const uint32_t *p) {
+		return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+	}
+};
+
 template<>
 inline void block<x86::ymm>::load(const uint8_t *p) {
 	const __m256i *q = reinterpret_cast<const __m256i *>(p);
@@ -66,6 +66,14 @@ public:
 
 }
 
+template<>
+struct lanes<x86::ymm2> {
+	static inline x86::ymm2 load(const uint32_t *p) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+		return x86::ymm2(v, v);
+	}
+};
+
 template<>
 inline size_t block_size<x86::ymm2>() {
 	return 120;
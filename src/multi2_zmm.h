@@ -0,0 +1,321 @@
+#pragma once
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+#include <utility>
+
+#if defined(_WIN32)
+# include <intrin.h>
+#else
+# include <x86intrin.h>
+#endif
+
+#include "portable.h"
+
+#include "multi2_block.h"
+
+namespace multi2 {
+
+namespace x86 {
+
+/*
+ * 16 lanes, holds up to 16 MULTI2 blocks in one register per half.
+ * blocks are kept in natural order (lane i = block i), partial blocks
+ * are read and written with masked loads/stores.
+ */
+template<size_t N>
+class zmm {
+private:
+	__m512i v;
+
+public:
+	inline zmm() {
+#if !defined(NO_MM_UNDEFINED)
+		v = _mm512_undefined_epi32();
+#endif
+	}
+	inline zmm(uint32_t n) { v = _mm512_set1_epi32(n); }
+	inline zmm(const __m512i &r) { v = r; }
+
+	inline zmm &operator=(const zmm &other) {
+		v = other.v;
+		return *this;
+	}
+
+	inline zmm operator+(const zmm &other) const { return _mm512_add_epi32(v, other.v); }
+	inline zmm operator-(const zmm &other) const { return _mm512_sub_epi32(v, other.v); }
+	inline zmm operator^(const zmm &other) const { return _mm512_xor_si512(v, other.v); }
+	inline zmm operator|(const zmm &other) const { return _mm512_or_si512(v, other.v); }
+	inline zmm operator<<(int n) const { return _mm512_maskz_slli_epi32(0xffff, v, n); }
+	inline zmm operator>>(int n) const { return _mm512_maskz_srli_epi32(0xffff, v, n); }
+
+	inline const __m512i &value() const { return v; }
+
+	static inline __mmask16 word_mask(size_t words) {
+		return (words < 16) ? static_cast<__mmask16>((1u << words) - 1) : static_cast<__mmask16>(0xffff);
+	}
+
+	static inline __m512i bswap(const __m512i &a) {
+		__m512i s = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+		return _mm512_shuffle_epi8(a, s);
+	}
+
+	/* 8 blocks (16 words) of memory <-> left/right halves */
+	static inline void deinterleave(const __m512i &a0, const __m512i &a1, __m512i &l, __m512i &r) {
+		__m512i e = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+		__m512i o = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+		l = _mm512_permutex2var_epi32(a0, e, a1);
+		r = _mm512_permutex2var_epi32(a0, o, a1);
+	}
+
+	static inline void interleave(const __m512i &l, const __m512i &r, __m512i &a0, __m512i &a1) {
+		__m512i lo = _mm512_set_epi32(23,  7, 22,  6, 21,  5, 20,  4, 19,  3, 18,  2, 17,  1, 16,  0);
+		__m512i hi = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12, 27, 11, 26, 10, 25,  9, 24,  8);
+		a0 = _mm512_permutex2var_epi32(l, lo, r);
+		a1 = _mm512_permutex2var_epi32(l, hi, r);
+	}
+
+	/* loads blocks [0, count) of p into l/r, count <= 16 */
+	static inline void load_half(const uint8_t *p, size_t count, __m512i &l, __m512i &r) {
+		__m512i a0, a1;
+		if (count == 16) {
+			a0 = _mm512_loadu_si512(p);
+			a1 = _mm512_loadu_si512(p + 64);
+		} else {
+			size_t w = count * 2;
+			a0 = _mm512_maskz_loadu_epi32(word_mask(w), p);
+			a1 = _mm512_maskz_loadu_epi32(word_mask(16 < w ? w - 16 : 0), p + 64);
+		}
+		deinterleave(bswap(a0), bswap(a1), l, r);
+	}
+
+	static inline void store_half(uint8_t *p, size_t count, const __m512i &l, const __m512i &r) {
+		__m512i a0, a1;
+		interleave(l, r, a0, a1);
+		a0 = bswap(a0);
+		a1 = bswap(a1);
+		if (count == 16) {
+			_mm512_storeu_si512(p,      a0);
+			_mm512_storeu_si512(p + 64, a1);
+		} else {
+			size_t w = count * 2;
+			_mm512_mask_storeu_epi32(p,      word_mask(w),                   a0);
+			_mm512_mask_storeu_epi32(p + 64, word_mask(16 < w ? w - 16 : 0), a1);
+		}
+	}
+
+	static inline uint32_t lane(const __m512i &a, int i) {
+		uint32_t r;
+		__m512i b = _mm512_maskz_permutexvar_epi32(0xffff, _mm512_set1_epi32(i), a);
+		_mm512_mask_storeu_epi32(&r, 1, b);
+		return r;
+	}
+
+	/* lane 0 <- s, lane i <- a[i-1] */
+	static inline __m512i shift_in(const __m512i &a, const __m512i &s) {
+		return _mm512_maskz_alignr_epi32(0xffff, a, s, 15);
+	}
+
+	static inline void load_block(block<zmm> &b, const uint8_t *p) {
+		__m512i l, r;
+		load_half(p, N, l, r);
+		b.left  = l;
+		b.right = r;
+	}
+
+	static inline void store_block(uint8_t *p, const block<zmm> &b) {
+		store_half(p, N, b.left.value(), b.right.value());
+	}
+
+	static inline std::pair<block<zmm>, cbc_state> cbc_post_decrypt(const block<zmm> &d, const block<zmm> &c, const cbc_state &state) {
+		__m512i c0 = c.left.value();
+		__m512i c1 = c.right.value();
+
+		uint32_t s0 = lane(c0, N - 1);
+		uint32_t s1 = lane(c1, N - 1);
+
+		__m512i x0 = shift_in(c0, _mm512_set1_epi32(state.left));
+		__m512i x1 = shift_in(c1, _mm512_set1_epi32(state.right));
+
+		__m512i p0 = _mm512_xor_si512(d.left.value(),  x0);
+		__m512i p1 = _mm512_xor_si512(d.right.value(), x1);
+
+		return std::make_pair(block<zmm>(p0, p1), cbc_state(s0, s1));
+	}
+};
+
+/*
+ * 32 lanes in two registers, holds 17 to 32 MULTI2 blocks.
+ * zmm2<23> covers a whole 184 byte TS payload in one pass.
+ */
+template<size_t N>
+class zmm2 {
+private:
+	__m512i v0;
+	__m512i v1;
+
+	typedef zmm<16> half;
+
+public:
+	inline zmm2() {
+#if !defined(NO_MM_UNDEFINED)
+		v0 = v1 = _mm512_undefined_epi32();
+#endif
+	}
+	inline zmm2(uint32_t n) { v0 = v1 = _mm512_set1_epi32(n); }
+	inline zmm2(const __m512i &r0, const __m512i &r1) {
+		v0 = r0;
+		v1 = r1;
+	}
+
+	inline zmm2 &operator=(const zmm2 &other) {
+		v0 = other.v0;
+		v1 = other.v1;
+		return *this;
+	}
+
+	inline zmm2 operator+(const zmm2 &other) const {
+		return zmm2(_mm512_add_epi32(v0, other.v0), _mm512_add_epi32(v1, other.v1));
+	}
+	inline zmm2 operator-(const zmm2 &other) const {
+		return zmm2(_mm512_sub_epi32(v0, other.v0), _mm512_sub_epi32(v1, other.v1));
+	}
+	inline zmm2 operator^(const zmm2 &other) const {
+		return zmm2(_mm512_xor_si512(v0, other.v0), _mm512_xor_si512(v1, other.v1));
+	}
+	inline zmm2 operator|(const zmm2 &other) const {
+		return zmm2(_mm512_or_si512(v0, other.v0), _mm512_or_si512(v1, other.v1));
+	}
+	inline zmm2 operator<<(int n) const {
+		return zmm2(_mm512_maskz_slli_epi32(0xffff, v0, n), _mm512_maskz_slli_epi32(0xffff, v1, n));
+	}
+	inline zmm2 operator>>(int n) const {
+		return zmm2(_mm512_maskz_srli_epi32(0xffff, v0, n), _mm512_maskz_srli_epi32(0xffff, v1, n));
+	}
+
+	inline const __m512i &value0() const { return v0; }
+	inline const __m512i &value1() const { return v1; }
+
+	static inline void load_block(block<zmm2> &b, const uint8_t *p) {
+		__m512i l0, r0, l1, r1;
+		half::load_half(p,       16,     l0, r0);
+		half::load_half(p + 128, N - 16, l1, r1);
+		b.left  = zmm2(l0, l1);
+		b.right = zmm2(r0, r1);
+	}
+
+	static inline void store_block(uint8_t *p, const block<zmm2> &b) {
+		half::store_half(p,       16,     b.left.value0(), b.right.value0());
+		half::store_half(p + 128, N - 16, b.left.value1(), b.right.value1());
+	}
+
+	static inline std::pair<block<zmm2>, cbc_state> cbc_post_decrypt(const block<zmm2> &d, const block<zmm2> &c, const cbc_state &state) {
+		__m512i c0 = c.left.value0();
+		__m512i c1 = c.right.value0();
+		__m512i c2 = c.left.value1();
+		__m512i c3 = c.right.value1();
+
+		uint32_t s2 = half::lane(c2, N - 17);
+		uint32_t s3 = half::lane(c3, N - 17);
+
+		__m512i x0 = half::shift_in(c0, _mm512_set1_epi32(state.left));
+		__m512i x1 = half::shift_in(c1, _mm512_set1_epi32(state.right));
+		__m512i x2 = half::shift_in(c2, c0);
+		__m512i x3 = half::shift_in(c3, c1);
+
+		__m512i p0 = _mm512_xor_si512(d.left.value0(),  x0);
+		__m512i p1 = _mm512_xor_si512(d.right.value0(), x1);
+		__m512i p2 = _mm512_xor_si512(d.left.value1(),  x2);
+		__m512i p3 = _mm512_xor_si512(d.right.value1(), x3);
+
+		return std::make_pair(block<zmm2>(zmm2(p0, p2), zmm2(p1, p3)), cbc_state(s2, s3));
+	}
+};
+
+}
+
+template<size_t N>
+struct lanes<x86::zmm<N> > {
+	static inline x86::zmm<N> load(const uint32_t *p) {
+		return _mm512_loadu_si512(p);
+	}
+};
+
+template<size_t N>
+struct lanes<x86::zmm2<N> > {
+	static inline x86::zmm2<N> load(const uint32_t *p) {
+		__m512i v = _mm512_loadu_si512(p);
+		return x86::zmm2<N>(v, v);
+	}
+};
+
+template<>
+inline size_t block_size<x86::zmm<16> >() {
+	return 128;
+}
+
+template<>
+inline size_t block_size<x86::zmm2<23> >() {
+	return 184;
+}
+
+template<>
+inline size_t block_size<x86::zmm2<32> >() {
+	return 256;
+}
+
+template<>
+inline void block<x86::zmm<16> >::load(const uint8_t *p) {
+	x86::zmm<16>::load_block(*this, p);
+}
+
+template<>
+inline void block<x86::zmm2<23> >::load(const uint8_t *p) {
+	x86::zmm2<23>::load_block(*this, p);
+}
+
+template<>
+inline void block<x86::zmm2<32> >::load(const uint8_t *p) {
+	x86::zmm2<32>::load_block(*this, p);
+}
+
+template<>
+inline void block<x86::zmm<16> >::store(uint8_t *p) const {
+	x86::zmm<16>::store_block(p, *this);
+}
+
+template<>
+inline void block<x86::zmm2<23> >::store(uint8_t *p) const {
+	x86::zmm2<23>::store_block(p, *this);
+}
+
+template<>
+inline void block<x86::zmm2<32> >::store(uint8_t *p) const {
+	x86::zmm2<32>::store_block(p, *this);
+}
+
+template<>
+inline std::pair<block<x86::zmm<16> >, cbc_state> block<x86::zmm<16> >::cbc_post_decrypt(const block<x86::zmm<16> > &c, const cbc_state &state) const {
+	return x86::zmm<16>::cbc_post_decrypt(*this, c, state);
+}
+
+template<>
+inline std::pair<block<x86::zmm2<23> >, cbc_state> block<x86::zmm2<23> >::cbc_post_decrypt(const block<x86::zmm2<23> > &c, const cbc_state &state) const {
+	return x86::zmm2<23>::cbc_post_decrypt(*this, c, state);
+}
+
+template<>
+inline std::pair<block<x86::zmm2<32> >, cbc_state> block<x86::zmm2<32> >::cbc_post_decrypt(const block<x86::zmm2<32> > &c, const cbc_state &state) const {
+	return x86::zmm2<32>::cbc_post_decrypt(*this, c, state);
+}
+
+/*
+ * shift/permute/alignr use the zero-masking forms with a full mask and lane()
+ * goes through a masked store: the plain intrinsics merge into
+ * _mm512_undefined_epi32() and trip -Wmaybe-uninitialized on some GCC versions. rot<N>() is left to the generic shift/or form,
+ * compilers fold it into a single vprold.
+ */
+
+}
+
+#endif /* __AVX512F__ && __AVX512BW__ */
@@ -0,0 +1,119 @@
+#include <cstdio>
+#include <vector>
+
+#include "ts_crc32.h"
+#include "ts_crc32_kernel.h"
+#include "multi2_cpu.h"
+
+/*
+ * checks every CRC-32/MPEG-2 implementation compiled in against the
+ * table version, on random data of every length from 0 to 4200 bytes at
+ * all 16 alignments, and the table version against a bit at a time
+ * reference. exits with 1 on the first mismatch.
+ */
+
+struct entry {
+	const char *name;
+	const TS_CRC32 *f;
+	bool usable;
+};
+
+static uint32_t crc32_bitwise(const uint8_t *p, size_t n)
+{
+	uint32_t crc = 0xffffffff;
+	for (size_t i = 0; i < n; ++i) {
+		crc ^= static_cast<uint32_t>(p[i]) << 24;
+		for (int j = 0; j < 8; ++j) {
+			crc = (crc & 0x80000000) ? ((crc << 1) ^ ts_crc32::POLY) : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+static uint32_t xorshift(uint32_t &s)
+{
+	s ^= s << 13;
+	s ^= s >> 17;
+	s ^= s << 5;
+	return s;
+}
+
+int main()
+{
+	enum {
+		MAX_LENGTH = 4200,
+		ALIGNMENT  = 16,
+	};
+
+	uint32_t f = multi2::cpu::features();
+	std::vector<entry> c;
+
+	entry slice16 = { "slice16", &ts_crc32::slice16, true };
+	c.push_back(slice16);
+#if defined(TS_CRC32_PCLMUL)
+	entry pclmul = { "pclmul", &ts_crc32::pclmul, (f & multi2::cpu::FEATURE_PCLMUL) && (f & multi2::cpu::FEATURE_SSSE3) };
+	c.push_back(pclmul);
+#endif
+#if defined(TS_CRC32_PMULL)
+	entry pmull = { "pmull", &ts_crc32::pmull, (f & multi2::cpu::FEATURE_PMULL) != 0 };
+	c.push_back(pmull);
+#endif
+	(void)f;
+
+	for (size_t i = 0; i < c.size(); ++i) {
+		printf("%s: %s\n", c[i].name, c[i].usable ? "checked" : "skipped, not supported by this CPU");
+	}
+
+	uint32_t seed = 0x2545f491;
+	std::vector<uint8_t> buf(MAX_LENGTH + ALIGNMENT);
+	int failed = 0;
+
+	for (int n = 0; n <= MAX_LENGTH; ++n) {
+		for (size_t i = 0; i < buf.size(); ++i) {
+			buf[i] = static_cast<uint8_t>(xorshift(seed));
+		}
+		for (int off = 0; off < ALIGNMENT; ++off) {
+			const uint8_t *head = &buf[off];
+			uint32_t expect = ts_crc32::table.calc(head, head + n);
+			if ((off == 0) && (n <= 512) && (expect != crc32_bitwise(head, n))) {
+				printf("table: mismatch at length %d\n", n);
+				failed += 1;
+			}
+			for (size_t i = 0; i < c.size(); ++i) {
+				if (c[i].usable && (c[i].f->calc(head, head + n) != expect)) {
+					printf("%s: mismatch at length %d, offset %d\n", c[i].name, n, off);
+					failed += 1;
+				}
+			}
+			if (failed > 16) {
+				return 1;
+			}
+		}
+	}
+
+	/* a whole section including its CRC_32 field gives 0 */
+	for (int n = 0; n <= 1024; ++n) {
+		uint32_t crc = ts_crc32::table.calc(&buf[0], &buf[n]);
+		buf[n + 0] = static_cast<uint8_t>(crc >> 24);
+		buf[n + 1] = static_cast<uint8_t>(crc >> 16);
+		buf[n + 2] = static_cast<uint8_t>(crc >> 8);
+		buf[n + 3] = static_cast<uint8_t>(crc);
+		if (ts_crc32::table.calc(&buf[0], &buf[n + 4]) != 0) {
+			printf("table: section with CRC_32 does not give 0 at length %d\n", n + 4);
+			failed += 1;
+		}
+		for (size_t i = 0; i < c.size(); ++i) {
+			if (c[i].usable && (c[i].f->calc(&buf[0], &buf[n + 4]) != 0)) {
+				printf("%s: section with CRC_32 does not give 0 at length %d\n", c[i].name, n + 4);
+				failed += 1;
+			}
+		}
+	}
+
+	if (failed > 0) {
+		return 1;
+	}
+
+	printf("ok\n");
+	return 0;
+}
@@ -0,0 +1,698 @@
+#include "ts_crc32.h"
+#include "ts_crc32_kernel.h"
+#include "multi2_cpu.h"
+
+static const uint32_t crc_table[256] = {
+	0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+	0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+	0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+	0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+
+	0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9,
+	0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+	0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011,
+	0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+
+	0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039,
+	0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+	0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81,
+	0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+
+	0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49,
+	0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+	0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1,
+	0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+
+	0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE,
+	0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+	0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16,
+	0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+
+	0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE,
+	0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+	0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066,
+	0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+
+	0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E,
+	0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+	0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6,
+	0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+
+	0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E,
+	0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+	0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686,
+	0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+
+	0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637,
+	0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+	0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F,
+	0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+
+	0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47,
+	0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+	0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF,
+	0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+
+	0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7,
+	0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+	0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F,
+	0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+
+	0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7,
+	0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+	0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F,
+	0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+
+	0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640,
+	0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+	0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8,
+	0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+
+	0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30,
+	0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+	0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088,
+	0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+
+	0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0,
+	0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+	0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18,
+	0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+
+	0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0,
+	0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+	0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668,
+	0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+};
+
+static uint32_t calc_table(const uint8_t *head, const uint8_t *tail)
+{
+	uint32_t crc = 0xffffffff;
+
+	for (const uint8_t *p = head; p < tail; ++p) {
+		crc = (crc << 8) ^ crc_table[((crc >> 24) ^ p[0]) & 0xff];
+	}
+
+	return crc;
+}
+
+const TS_CRC32 ts_crc32::table = {
+	calc_table,
+};
+
+/* crc_slice[k][b] is the CRC register after b followed by k zero bytes,
+   crc_slice[0] is crc_table */
+static const uint32_t crc_slice[16][256] = {
+	{
+		0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+		0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+		0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+		0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+		0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+		0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+		0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+		0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+		0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+		0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+		0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+		0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+		0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+		0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+		0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+		0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+		0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+		0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+		0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+		0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+		0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+		0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+		0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+		0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+		0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+		0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+		0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+		0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+		0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+		0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+		0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+		0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+	},
+	{
+		0x00000000, 0xD219C1DC, 0xA0F29E0F, 0x72EB5FD3, 0x452421A9, 0x973DE075, 0xE5D6BFA6, 0x37CF7E7A,
+		0x8A484352, 0x5851828E, 0x2ABADD5D, 0xF8A31C81, 0xCF6C62FB, 0x1D75A327, 0x6F9EFCF4, 0xBD873D28,
+		0x10519B13, 0xC2485ACF, 0xB0A3051C, 0x62BAC4C0, 0x5575BABA, 0x876C7B66, 0xF58724B5, 0x279EE569,
+		0x9A19D841, 0x4800199D, 0x3AEB464E, 0xE8F28792, 0xDF3DF9E8, 0x0D243834, 0x7FCF67E7, 0xADD6A63B,
+		0x20A33626, 0xF2BAF7FA, 0x8051A829, 0x524869F5, 0x6587178F, 0xB79ED653, 0xC5758980, 0x176C485C,
+		0xAAEB7574, 0x78F2B4A8, 0x0A19EB7B, 0xD8002AA7, 0xEFCF54DD, 0x3DD69501, 0x4F3DCAD2, 0x9D240B0E,
+		0x30F2AD35, 0xE2EB6CE9, 0x9000333A, 0x4219F2E6, 0x75D68C9C, 0xA7CF4D40, 0xD5241293, 0x073DD34F,
+		0xBABAEE67, 0x68A32FBB, 0x1A487068, 0xC851B1B4, 0xFF9ECFCE, 0x2D870E12, 0x5F6C51C1, 0x8D75901D,
+		0x41466C4C, 0x935FAD90, 0xE1B4F243, 0x33AD339F, 0x04624DE5, 0xD67B8C39, 0xA490D3EA, 0x76891236,
+		0xCB0E2F1E, 0x1917EEC2, 0x6BFCB111, 0xB9E570CD, 0x8E2A0EB7, 0x5C33CF6B, 0x2ED890B8, 0xFCC15164,
+		0x5117F75F, 0x830E3683, 0xF1E56950, 0x23FCA88C, 0x1433D6F6, 0xC62A172A, 0xB4C148F9, 0x66D88925,
+		0xDB5FB40D, 0x094675D1, 0x7BAD2A02, 0xA9B4EBDE, 0x9E7B95A4, 0x4C625478, 0x3E890BAB, 0xEC90CA77,
+		0x61E55A6A, 0xB3FC9BB6, 0xC117C465, 0x130E05B9, 0x24C17BC3, 0xF6D8BA1F, 0x8433E5CC, 0x562A2410,
+		0xEBAD1938, 0x39B4D8E4, 0x4B5F8737, 0x994646EB, 0xAE893891, 0x7C90F94D, 0x0E7BA69E, 0xDC626742,
+		0x71B4C179, 0xA3AD00A5, 0xD1465F76, 0x035F9EAA, 0x3490E0D0, 0xE689210C, 0x94627EDF, 0x467BBF03,
+		0xFBFC822B, 0x29E543F7, 0x5B0E1C24, 0x8917DDF8, 0xBED8A382, 0x6CC1625E, 0x1E2A3D8D, 0xCC33FC51,
+		0x828CD898, 0x50951944, 0x227E4697, 0xF067874B, 0xC7A8F931, 0x15B138ED, 0x675A673E, 0xB543A6E2,
+		0x08C49BCA, 0xDADD5A16, 0xA83605C5, 0x7A2FC419, 0x4DE0BA63, 0x9FF97BBF, 0xED12246C, 0x3F0BE5B0,
+		0x92DD438B, 0x40C48257, 0x322FDD84, 0xE0361C58, 0xD7F96222, 0x05E0A3FE, 0x770BFC2D, 0xA5123DF1,
+		0x189500D9, 0xCA8CC105, 0xB8679ED6, 0x6A7E5F0A, 0x5DB12170, 0x8FA8E0AC, 0xFD43BF7F, 0x2F5A7EA3,
+		0xA22FEEBE, 0x70362F62, 0x02DD70B1, 0xD0C4B16D, 0xE70BCF17, 0x35120ECB, 0x47F95118, 0x95E090C4,
+		0x2867ADEC, 0xFA7E6C30, 0x889533E3, 0x5A8CF23F, 0x6D438C45, 0xBF5A4D99, 0xCDB1124A, 0x1FA8D396,
+		0xB27E75AD, 0x6067B471, 0x128CEBA2, 0xC0952A7E, 0xF75A5404, 0x254395D8, 0x57A8CA0B, 0x85B10BD7,
+		0x383636FF, 0xEA2FF723, 0x98C4A8F0, 0x4ADD692C, 0x7D121756, 0xAF0BD68A, 0xDDE08959, 0x0FF94885,
+		0xC3CAB4D4, 0x11D37508, 0x63382ADB, 0xB121EB07, 0x86EE957D, 0x54F754A1, 0x261C0B72, 0xF405CAAE,
+		0x4982F786, 0x9B9B365A, 0xE9706989, 0x3B69A855, 0x0CA6D62F, 0xDEBF17F3, 0xAC544820, 0x7E4D89FC,
+		0xD39B2FC7, 0x0182EE1B, 0x7369B1C8, 0xA1707014, 0x96BF0E6E, 0x44A6CFB2, 0x364D9061, 0xE45451BD,
+		0x59D36C95, 0x8BCAAD49, 0xF921F29A, 0x2B383346, 0x1CF74D3C, 0xCEEE8CE0, 0xBC05D333, 0x6E1C12EF,
+		0xE36982F2, 0x3170432E, 0x439B1CFD, 0x9182DD21, 0xA64DA35B, 0x74546287, 0x06BF3D54, 0xD4A6FC88,
+		0x6921C1A0, 0xBB38007C, 0xC9D35FAF, 0x1BCA9E73, 0x2C05E009, 0xFE1C21D5, 0x8CF77E06, 0x5EEEBFDA,
+		0xF33819E1, 0x2121D83D, 0x53CA87EE, 0x81D34632, 0xB61C3848, 0x6405F994, 0x16EEA647, 0xC4F7679B,
+		0x79705AB3, 0xAB699B6F, 0xD982C4BC, 0x0B9B0560, 0x3C547B1A, 0xEE4DBAC6, 0x9CA6E515, 0x4EBF24C9,
+	},
+	{
+		0x00000000, 0x01D8AC87, 0x03B1590E, 0x0269F589, 0x0762B21C, 0x06BA1E9B, 0x04D3EB12, 0x050B4795,
+		0x0EC56438, 0x0F1DC8BF, 0x0D743D36, 0x0CAC91B1, 0x09A7D624, 0x087F7AA3, 0x0A168F2A, 0x0BCE23AD,
+		0x1D8AC870, 0x1C5264F7, 0x1E3B917E, 0x1FE33DF9, 0x1AE87A6C, 0x1B30D6EB, 0x19592362, 0x18818FE5,
+		0x134FAC48, 0x129700CF, 0x10FEF546, 0x112659C1, 0x142D1E54, 0x15F5B2D3, 0x179C475A, 0x1644EBDD,
+		0x3B1590E0, 0x3ACD3C67, 0x38A4C9EE, 0x397C6569, 0x3C7722FC, 0x3DAF8E7B, 0x3FC67BF2, 0x3E1ED775,
+		0x35D0F4D8, 0x3408585F, 0x3661ADD6, 0x37B90151, 0x32B246C4, 0x336AEA43, 0x31031FCA, 0x30DBB34D,
+		0x269F5890, 0x2747F417, 0x252E019E, 0x24F6AD19, 0x21FDEA8C, 0x2025460B, 0x224CB382, 0x23941F05,
+		0x285A3CA8, 0x2982902F, 0x2BEB65A6, 0x2A33C921, 0x2F388EB4, 0x2EE02233, 0x2C89D7BA, 0x2D517B3D,
+		0x762B21C0, 0x77F38D47, 0x759A78CE, 0x7442D449, 0x714993DC, 0x70913F5B, 0x72F8CAD2, 0x73206655,
+		0x78EE45F8, 0x7936E97F, 0x7B5F1CF6, 0x7A87B071, 0x7F8CF7E4, 0x7E545B63, 0x7C3DAEEA, 0x7DE5026D,
+		0x6BA1E9B0, 0x6A794537, 0x6810B0BE, 0x69C81C39, 0x6CC35BAC, 0x6D1BF72B, 0x6F7202A2, 0x6EAAAE25,
+		0x65648D88, 0x64BC210F, 0x66D5D486, 0x670D7801, 0x62063F94, 0x63DE9313, 0x61B7669A, 0x606FCA1D,
+		0x4D3EB120, 0x4CE61DA7, 0x4E8FE82E, 0x4F5744A9, 0x4A5C033C, 0x4B84AFBB, 0x49ED5A32, 0x4835F6B5,
+		0x43FBD518, 0x4223799F, 0x404A8C16, 0x41922091, 0x44996704, 0x4541CB83, 0x47283E0A, 0x46F0928D,
+		0x50B47950, 0x516CD5D7, 0x5305205E, 0x52DD8CD9, 0x57D6CB4C, 0x560E67CB, 0x54679242, 0x55BF3EC5,
+		0x5E711D68, 0x5FA9B1EF, 0x5DC04466, 0x5C18E8E1, 0x5913AF74, 0x58CB03F3, 0x5AA2F67A, 0x5B7A5AFD,
+		0xEC564380, 0xED8EEF07, 0xEFE71A8E, 0xEE3FB609, 0xEB34F19C, 0xEAEC5D1B, 0xE885A892, 0xE95D0415,
+		0xE29327B8, 0xE34B8B3F, 0xE1227EB6, 0xE0FAD231, 0xE5F195A4, 0xE4293923, 0xE640CCAA, 0xE798602D,
+		0xF1DC8BF0, 0xF0042777, 0xF26DD2FE, 0xF3B57E79, 0xF6BE39EC, 0xF766956B, 0xF50F60E2, 0xF4D7CC65,
+		0xFF19EFC8, 0xFEC1434F, 0xFCA8B6C6, 0xFD701A41, 0xF87B5DD4, 0xF9A3F153, 0xFBCA04DA, 0xFA12A85D,
+		0xD743D360, 0xD69B7FE7, 0xD4F28A6E, 0xD52A26E9, 0xD021617C, 0xD1F9CDFB, 0xD3903872, 0xD24894F5,
+		0xD986B758, 0xD85E1BDF, 0xDA37EE56, 0xDBEF42D1, 0xDEE40544, 0xDF3CA9C3, 0xDD555C4A, 0xDC8DF0CD,
+		0xCAC91B10, 0xCB11B797, 0xC978421E, 0xC8A0EE99, 0xCDABA90C, 0xCC73058B, 0xCE1AF002, 0xCFC25C85,
+		0xC40C7F28, 0xC5D4D3AF, 0xC7BD2626, 0xC6658AA1, 0xC36ECD34, 0xC2B661B3, 0xC0DF943A, 0xC10738BD,
+		0x9A7D6240, 0x9BA5CEC7, 0x99CC3B4E, 0x981497C9, 0x9D1FD05C, 0x9CC77CDB, 0x9EAE8952, 0x9F7625D5,
+		0x94B80678, 0x9560AAFF, 0x97095F76, 0x96D1F3F1, 0x93DAB464, 0x920218E3, 0x906BED6A, 0x91B341ED,
+		0x87F7AA30, 0x862F06B7, 0x8446F33E, 0x859E5FB9, 0x8095182C, 0x814DB4AB, 0x83244122, 0x82FCEDA5,
+		0x8932CE08, 0x88EA628F, 0x8A839706, 0x8B5B3B81, 0x8E507C14, 0x8F88D093, 0x8DE1251A, 0x8C39899D,
+		0xA168F2A0, 0xA0B05E27, 0xA2D9ABAE, 0xA3010729, 0xA60A40BC, 0xA7D2EC3B, 0xA5BB19B2, 0xA463B535,
+		0xAFAD9698, 0xAE753A1F, 0xAC1CCF96, 0xADC46311, 0xA8CF2484, 0xA9178803, 0xAB7E7D8A, 0xAAA6D10D,
+		0xBCE23AD0, 0xBD3A9657, 0xBF5363DE, 0xBE8BCF59, 0xBB8088CC, 0xBA58244B, 0xB831D1C2, 0xB9E97D45,
+		0xB2275EE8, 0xB3FFF26F, 0xB19607E6, 0xB04EAB61, 0xB545ECF4, 0xB49D4073, 0xB6F4B5FA, 0xB72C197D,
+	},
+	{
+		0x00000000, 0xDC6D9AB7, 0xBC1A28D9, 0x6077B26E, 0x7CF54C05, 0xA098D6B2, 0xC0EF64DC, 0x1C82FE6B,
+		0xF9EA980A, 0x258702BD, 0x45F0B0D3, 0x999D2A64, 0x851FD40F, 0x59724EB8, 0x3905FCD6, 0xE5686661,
+		0xF7142DA3, 0x2B79B714, 0x4B0E057A, 0x97639FCD, 0x8BE161A6, 0x578CFB11, 0x37FB497F, 0xEB96D3C8,
+		0x0EFEB5A9, 0xD2932F1E, 0xB2E49D70, 0x6E8907C7, 0x720BF9AC, 0xAE66631B, 0xCE11D175, 0x127C4BC2,
+		0xEAE946F1, 0x3684DC46, 0x56F36E28, 0x8A9EF49F, 0x961C0AF4, 0x4A719043, 0x2A06222D, 0xF66BB89A,
+		0x1303DEFB, 0xCF6E444C, 0xAF19F622, 0x73746C95, 0x6FF692FE, 0xB39B0849, 0xD3ECBA27, 0x0F812090,
+		0x1DFD6B52, 0xC190F1E5, 0xA1E7438B, 0x7D8AD93C, 0x61082757, 0xBD65BDE0, 0xDD120F8E, 0x017F9539,
+		0xE417F358, 0x387A69EF, 0x580DDB81, 0x84604136, 0x98E2BF5D, 0x448F25EA, 0x24F89784, 0xF8950D33,
+		0xD1139055, 0x0D7E0AE2, 0x6D09B88C, 0xB164223B, 0xADE6DC50, 0x718B46E7, 0x11FCF489, 0xCD916E3E,
+		0x28F9085F, 0xF49492E8, 0x94E32086, 0x488EBA31, 0x540C445A, 0x8861DEED, 0xE8166C83, 0x347BF634,
+		0x2607BDF6, 0xFA6A2741, 0x9A1D952F, 0x46700F98, 0x5AF2F1F3, 0x869F6B44, 0xE6E8D92A, 0x3A85439D,
+		0xDFED25FC, 0x0380BF4B, 0x63F70D25, 0xBF9A9792, 0xA31869F9, 0x7F75F34E, 0x1F024120, 0xC36FDB97,
+		0x3BFAD6A4, 0xE7974C13, 0x87E0FE7D, 0x5B8D64CA, 0x470F9AA1, 0x9B620016, 0xFB15B278, 0x277828CF,
+		0xC2104EAE, 0x1E7DD419, 0x7E0A6677, 0xA267FCC0, 0xBEE502AB, 0x6288981C, 0x02FF2A72, 0xDE92B0C5,
+		0xCCEEFB07, 0x108361B0, 0x70F4D3DE, 0xAC994969, 0xB01BB702, 0x6C762DB5, 0x0C019FDB, 0xD06C056C,
+		0x3504630D, 0xE969F9BA, 0x891E4BD4, 0x5573D163, 0x49F12F08, 0x959CB5BF, 0xF5EB07D1, 0x29869D66,
+		0xA6E63D1D, 0x7A8BA7AA, 0x1AFC15C4, 0xC6918F73, 0xDA137118, 0x067EEBAF, 0x660959C1, 0xBA64C376,
+		0x5F0CA517, 0x83613FA0, 0xE3168DCE, 0x3F7B1779, 0x23F9E912, 0xFF9473A5, 0x9FE3C1CB, 0x438E5B7C,
+		0x51F210BE, 0x8D9F8A09, 0xEDE83867, 0x3185A2D0, 0x2D075CBB, 0xF16AC60C, 0x911D7462, 0x4D70EED5,
+		0xA81888B4, 0x74751203, 0x1402A06D, 0xC86F3ADA, 0xD4EDC4B1, 0x08805E06, 0x68F7EC68, 0xB49A76DF,
+		0x4C0F7BEC, 0x9062E15B, 0xF0155335, 0x2C78C982, 0x30FA37E9, 0xEC97AD5E, 0x8CE01F30, 0x508D8587,
+		0xB5E5E3E6, 0x69887951, 0x09FFCB3F, 0xD5925188, 0xC910AFE3, 0x157D3554, 0x750A873A, 0xA9671D8D,
+		0xBB1B564F, 0x6776CCF8, 0x07017E96, 0xDB6CE421, 0xC7EE1A4A, 0x1B8380FD, 0x7BF43293, 0xA799A824,
+		0x42F1CE45, 0x9E9C54F2, 0xFEEBE69C, 0x22867C2B, 0x3E048240, 0xE26918F7, 0x821EAA99, 0x5E73302E,
+		0x77F5AD48, 0xAB9837FF, 0xCBEF8591, 0x17821F26, 0x0B00E14D, 0xD76D7BFA, 0xB71AC994, 0x6B775323,
+		0x8E1F3542, 0x5272AFF5, 0x32051D9B, 0xEE68872C, 0xF2EA7947, 0x2E87E3F0, 0x4EF0519E, 0x929DCB29,
+		0x80E180EB, 0x5C8C1A5C, 0x3CFBA832, 0xE0963285, 0xFC14CCEE, 0x20795659, 0x400EE437, 0x9C637E80,
+		0x790B18E1, 0xA5668256, 0xC5113038, 0x197CAA8F, 0x05FE54E4, 0xD993CE53, 0xB9E47C3D, 0x6589E68A,
+		0x9D1CEBB9, 0x4171710E, 0x2106C360, 0xFD6B59D7, 0xE1E9A7BC, 0x3D843D0B, 0x5DF38F65, 0x819E15D2,
+		0x64F673B3, 0xB89BE904, 0xD8EC5B6A, 0x0481C1DD, 0x18033FB6, 0xC46EA501, 0xA419176F, 0x78748DD8,
+		0x6A08C61A, 0xB6655CAD, 0xD612EEC3, 0x0A7F7474, 0x16FD8A1F, 0xCA9010A8, 0xAAE7A2C6, 0x768A3871,
+		0x93E25E10, 0x4F8FC4A7, 0x2FF876C9, 0xF395EC7E, 0xEF171215, 0x337A88A2, 0x530D3ACC, 0x8F60A07B,
+	},
+	{
+		0x00000000, 0x490D678D, 0x921ACF1A, 0xDB17A897, 0x20F48383, 0x69F9E40E, 0xB2EE4C99, 0xFBE32B14,
+		0x41E90706, 0x08E4608B, 0xD3F3C81C, 0x9AFEAF91, 0x611D8485, 0x2810E308, 0xF3074B9F, 0xBA0A2C12,
+		0x83D20E0C, 0xCADF6981, 0x11C8C116, 0x58C5A69B, 0xA3268D8F, 0xEA2BEA02, 0x313C4295, 0x78312518,
+		0xC23B090A, 0x8B366E87, 0x5021C610, 0x192CA19D, 0xE2CF8A89, 0xABC2ED04, 0x70D54593, 0x39D8221E,
+		0x036501AF, 0x4A686622, 0x917FCEB5, 0xD872A938, 0x2391822C, 0x6A9CE5A1, 0xB18B4D36, 0xF8862ABB,
+		0x428C06A9, 0x0B816124, 0xD096C9B3, 0x999BAE3E, 0x6278852A, 0x2B75E2A7, 0xF0624A30, 0xB96F2DBD,
+		0x80B70FA3, 0xC9BA682E, 0x12ADC0B9, 0x5BA0A734, 0xA0438C20, 0xE94EEBAD, 0x3259433A, 0x7B5424B7,
+		0xC15E08A5, 0x88536F28, 0x5344C7BF, 0x1A49A032, 0xE1AA8B26, 0xA8A7ECAB, 0x73B0443C, 0x3ABD23B1,
+		0x06CA035E, 0x4FC764D3, 0x94D0CC44, 0xDDDDABC9, 0x263E80DD, 0x6F33E750, 0xB4244FC7, 0xFD29284A,
+		0x47230458, 0x0E2E63D5, 0xD539CB42, 0x9C34ACCF, 0x67D787DB, 0x2EDAE056, 0xF5CD48C1, 0xBCC02F4C,
+		0x85180D52, 0xCC156ADF, 0x1702C248, 0x5E0FA5C5, 0xA5EC8ED1, 0xECE1E95C, 0x37F641CB, 0x7EFB2646,
+		0xC4F10A54, 0x8DFC6DD9, 0x56EBC54E, 0x1FE6A2C3, 0xE40589D7, 0xAD08EE5A, 0x761F46CD, 0x3F122140,
+		0x05AF02F1, 0x4CA2657C, 0x97B5CDEB, 0xDEB8AA66, 0x255B8172, 0x6C56E6FF, 0xB7414E68, 0xFE4C29E5,
+		0x444605F7, 0x0D4B627A, 0xD65CCAED, 0x9F51AD60, 0x64B28674, 0x2DBFE1F9, 0xF6A8496E, 0xBFA52EE3,
+		0x867D0CFD, 0xCF706B70, 0x1467C3E7, 0x5D6AA46A, 0xA6898F7E, 0xEF84E8F3, 0x34934064, 0x7D9E27E9,
+		0xC7940BFB, 0x8E996C76, 0x558EC4E1, 0x1C83A36C, 0xE7608878, 0xAE6DEFF5, 0x757A4762, 0x3C7720EF,
+		0x0D9406BC, 0x44996131, 0x9F8EC9A6, 0xD683AE2B, 0x2D60853F, 0x646DE2B2, 0xBF7A4A25, 0xF6772DA8,
+		0x4C7D01BA, 0x05706637, 0xDE67CEA0, 0x976AA92D, 0x6C898239, 0x2584E5B4, 0xFE934D23, 0xB79E2AAE,
+		0x8E4608B0, 0xC74B6F3D, 0x1C5CC7AA, 0x5551A027, 0xAEB28B33, 0xE7BFECBE, 0x3CA84429, 0x75A523A4,
+		0xCFAF0FB6, 0x86A2683B, 0x5DB5C0AC, 0x14B8A721, 0xEF5B8C35, 0xA656EBB8, 0x7D41432F, 0x344C24A2,
+		0x0EF10713, 0x47FC609E, 0x9CEBC809, 0xD5E6AF84, 0x2E058490, 0x6708E31D, 0xBC1F4B8A, 0xF5122C07,
+		0x4F180015, 0x06156798, 0xDD02CF0F, 0x940FA882, 0x6FEC8396, 0x26E1E41B, 0xFDF64C8C, 0xB4FB2B01,
+		0x8D23091F, 0xC42E6E92, 0x1F39C605, 0x5634A188, 0xADD78A9C, 0xE4DAED11, 0x3FCD4586, 0x76C0220B,
+		0xCCCA0E19, 0x85C76994, 0x5ED0C103, 0x17DDA68E, 0xEC3E8D9A, 0xA533EA17, 0x7E244280, 0x3729250D,
+		0x0B5E05E2, 0x4253626F, 0x9944CAF8, 0xD049AD75, 0x2BAA8661, 0x62A7E1EC, 0xB9B0497B, 0xF0BD2EF6,
+		0x4AB702E4, 0x03BA6569, 0xD8ADCDFE, 0x91A0AA73, 0x6A438167, 0x234EE6EA, 0xF8594E7D, 0xB15429F0,
+		0x888C0BEE, 0xC1816C63, 0x1A96C4F4, 0x539BA379, 0xA878886D, 0xE175EFE0, 0x3A624777, 0x736F20FA,
+		0xC9650CE8, 0x80686B65, 0x5B7FC3F2, 0x1272A47F, 0xE9918F6B, 0xA09CE8E6, 0x7B8B4071, 0x328627FC,
+		0x083B044D, 0x413663C0, 0x9A21CB57, 0xD32CACDA, 0x28CF87CE, 0x61C2E043, 0xBAD548D4, 0xF3D82F59,
+		0x49D2034B, 0x00DF64C6, 0xDBC8CC51, 0x92C5ABDC, 0x692680C8, 0x202BE745, 0xFB3C4FD2, 0xB231285F,
+		0x8BE90A41, 0xC2E46DCC, 0x19F3C55B, 0x50FEA2D6, 0xAB1D89C2, 0xE210EE4F, 0x390746D8, 0x700A2155,
+		0xCA000D47, 0x830D6ACA, 0x581AC25D, 0x1117A5D0, 0xEAF48EC4, 0xA3F9E949, 0x78EE41DE, 0x31E32653,
+	},
+	{
+		0x00000000, 0x1B280D78, 0x36501AF0, 0x2D781788, 0x6CA035E0, 0x77883898, 0x5AF02F10, 0x41D82268,
+		0xD9406BC0, 0xC26866B8, 0xEF107130, 0xF4387C48, 0xB5E05E20, 0xAEC85358, 0x83B044D0, 0x989849A8,
+		0xB641CA37, 0xAD69C74F, 0x8011D0C7, 0x9B39DDBF, 0xDAE1FFD7, 0xC1C9F2AF, 0xECB1E527, 0xF799E85F,
+		0x6F01A1F7, 0x7429AC8F, 0x5951BB07, 0x4279B67F, 0x03A19417, 0x1889996F, 0x35F18EE7, 0x2ED9839F,
+		0x684289D9, 0x736A84A1, 0x5E129329, 0x453A9E51, 0x04E2BC39, 0x1FCAB141, 0x32B2A6C9, 0x299AABB1,
+		0xB102E219, 0xAA2AEF61, 0x8752F8E9, 0x9C7AF591, 0xDDA2D7F9, 0xC68ADA81, 0xEBF2CD09, 0xF0DAC071,
+		0xDE0343EE, 0xC52B4E96, 0xE853591E, 0xF37B5466, 0xB2A3760E, 0xA98B7B76, 0x84F36CFE, 0x9FDB6186,
+		0x0743282E, 0x1C6B2556, 0x311332DE, 0x2A3B3FA6, 0x6BE31DCE, 0x70CB10B6, 0x5DB3073E, 0x469B0A46,
+		0xD08513B2, 0xCBAD1ECA, 0xE6D50942, 0xFDFD043A, 0xBC252652, 0xA70D2B2A, 0x8A753CA2, 0x915D31DA,
+		0x09C57872, 0x12ED750A, 0x3F956282, 0x24BD6FFA, 0x65654D92, 0x7E4D40EA, 0x53355762, 0x481D5A1A,
+		0x66C4D985, 0x7DECD4FD, 0x5094C375, 0x4BBCCE0D, 0x0A64EC65, 0x114CE11D, 0x3C34F695, 0x271CFBED,
+		0xBF84B245, 0xA4ACBF3D, 0x89D4A8B5, 0x92FCA5CD, 0xD32487A5, 0xC80C8ADD, 0xE5749D55, 0xFE5C902D,
+		0xB8C79A6B, 0xA3EF9713, 0x8E97809B, 0x95BF8DE3, 0xD467AF8B, 0xCF4FA2F3, 0xE237B57B, 0xF91FB803,
+		0x6187F1AB, 0x7AAFFCD3, 0x57D7EB5B, 0x4CFFE623, 0x0D27C44B, 0x160FC933, 0x3B77DEBB, 0x205FD3C3,
+		0x0E86505C, 0x15AE5D24, 0x38D64AAC, 0x23FE47D4, 0x622665BC, 0x790E68C4, 0x54767F4C, 0x4F5E7234,
+		0xD7C63B9C, 0xCCEE36E4, 0xE196216C, 0xFABE2C14, 0xBB660E7C, 0xA04E0304, 0x8D36148C, 0x961E19F4,
+		0xA5CB3AD3, 0xBEE337AB, 0x939B2023, 0x88B32D5B, 0xC96B0F33, 0xD243024B, 0xFF3B15C3, 0xE41318BB,
+		0x7C8B5113, 0x67A35C6B, 0x4ADB4BE3, 0x51F3469B, 0x102B64F3, 0x0B03698B, 0x267B7E03, 0x3D53737B,
+		0x138AF0E4, 0x08A2FD9C, 0x25DAEA14, 0x3EF2E76C, 0x7F2AC504, 0x6402C87C, 0x497ADFF4, 0x5252D28C,
+		0xCACA9B24, 0xD1E2965C, 0xFC9A81D4, 0xE7B28CAC, 0xA66AAEC4, 0xBD42A3BC, 0x903AB434, 0x8B12B94C,
+		0xCD89B30A, 0xD6A1BE72, 0xFBD9A9FA, 0xE0F1A482, 0xA12986EA, 0xBA018B92, 0x97799C1A, 0x8C519162,
+		0x14C9D8CA, 0x0FE1D5B2, 0x2299C23A, 0x39B1CF42, 0x7869ED2A, 0x6341E052, 0x4E39F7DA, 0x5511FAA2,
+		0x7BC8793D, 0x60E07445, 0x4D9863CD, 0x56B06EB5, 0x17684CDD, 0x0C4041A5, 0x2138562D, 0x3A105B55,
+		0xA28812FD, 0xB9A01F85, 0x94D8080D, 0x8FF00575, 0xCE28271D, 0xD5002A65, 0xF8783DED, 0xE3503095,
+		0x754E2961, 0x6E662419, 0x431E3391, 0x58363EE9, 0x19EE1C81, 0x02C611F9, 0x2FBE0671, 0x34960B09,
+		0xAC0E42A1, 0xB7264FD9, 0x9A5E5851, 0x81765529, 0xC0AE7741, 0xDB867A39, 0xF6FE6DB1, 0xEDD660C9,
+		0xC30FE356, 0xD827EE2E, 0xF55FF9A6, 0xEE77F4DE, 0xAFAFD6B6, 0xB487DBCE, 0x99FFCC46, 0x82D7C13E,
+		0x1A4F8896, 0x016785EE, 0x2C1F9266, 0x37379F1E, 0x76EFBD76, 0x6DC7B00E, 0x40BFA786, 0x5B97AAFE,
+		0x1D0CA0B8, 0x0624ADC0, 0x2B5CBA48, 0x3074B730, 0x71AC9558, 0x6A849820, 0x47FC8FA8, 0x5CD482D0,
+		0xC44CCB78, 0xDF64C600, 0xF21CD188, 0xE934DCF0, 0xA8ECFE98, 0xB3C4F3E0, 0x9EBCE468, 0x8594E910,
+		0xAB4D6A8F, 0xB06567F7, 0x9D1D707F, 0x86357D07, 0xC7ED5F6F, 0xDCC55217, 0xF1BD459F, 0xEA9548E7,
+		0x720D014F, 0x69250C37, 0x445D1BBF, 0x5F7516C7, 0x1EAD34AF, 0x058539D7, 0x28FD2E5F, 0x33D52327,
+	},
+	{
+		0x00000000, 0x4F576811, 0x9EAED022, 0xD1F9B833, 0x399CBDF3, 0x76CBD5E2, 0xA7326DD1, 0xE86505C0,
+		0x73397BE6, 0x3C6E13F7, 0xED97ABC4, 0xA2C0C3D5, 0x4AA5C615, 0x05F2AE04, 0xD40B1637, 0x9B5C7E26,
+		0xE672F7CC, 0xA9259FDD, 0x78DC27EE, 0x378B4FFF, 0xDFEE4A3F, 0x90B9222E, 0x41409A1D, 0x0E17F20C,
+		0x954B8C2A, 0xDA1CE43B, 0x0BE55C08, 0x44B23419, 0xACD731D9, 0xE38059C8, 0x3279E1FB, 0x7D2E89EA,
+		0xC824F22F, 0x87739A3E, 0x568A220D, 0x19DD4A1C, 0xF1B84FDC, 0xBEEF27CD, 0x6F169FFE, 0x2041F7EF,
+		0xBB1D89C9, 0xF44AE1D8, 0x25B359EB, 0x6AE431FA, 0x8281343A, 0xCDD65C2B, 0x1C2FE418, 0x53788C09,
+		0x2E5605E3, 0x61016DF2, 0xB0F8D5C1, 0xFFAFBDD0, 0x17CAB810, 0x589DD001, 0x89646832, 0xC6330023,
+		0x5D6F7E05, 0x12381614, 0xC3C1AE27, 0x8C96C636, 0x64F3C3F6, 0x2BA4ABE7, 0xFA5D13D4, 0xB50A7BC5,
+		0x9488F9E9, 0xDBDF91F8, 0x0A2629CB, 0x457141DA, 0xAD14441A, 0xE2432C0B, 0x33BA9438, 0x7CEDFC29,
+		0xE7B1820F, 0xA8E6EA1E, 0x791F522D, 0x36483A3C, 0xDE2D3FFC, 0x917A57ED, 0x4083EFDE, 0x0FD487CF,
+		0x72FA0E25, 0x3DAD6634, 0xEC54DE07, 0xA303B616, 0x4B66B3D6, 0x0431DBC7, 0xD5C863F4, 0x9A9F0BE5,
+		0x01C375C3, 0x4E941DD2, 0x9F6DA5E1, 0xD03ACDF0, 0x385FC830, 0x7708A021, 0xA6F11812, 0xE9A67003,
+		0x5CAC0BC6, 0x13FB63D7, 0xC202DBE4, 0x8D55B3F5, 0x6530B635, 0x2A67DE24, 0xFB9E6617, 0xB4C90E06,
+		0x2F957020, 0x60C21831, 0xB13BA002, 0xFE6CC813, 0x1609CDD3, 0x595EA5C2, 0x88A71DF1, 0xC7F075E0,
+		0xBADEFC0A, 0xF589941B, 0x24702C28, 0x6B274439, 0x834241F9, 0xCC1529E8, 0x1DEC91DB, 0x52BBF9CA,
+		0xC9E787EC, 0x86B0EFFD, 0x574957CE, 0x181E3FDF, 0xF07B3A1F, 0xBF2C520E, 0x6ED5EA3D, 0x2182822C,
+		0x2DD0EE65, 0x62878674, 0xB37E3E47, 0xFC295656, 0x144C5396, 0x5B1B3B87, 0x8AE283B4, 0xC5B5EBA5,
+		0x5EE99583, 0x11BEFD92, 0xC04745A1, 0x8F102DB0, 0x67752870, 0x28224061, 0xF9DBF852, 0xB68C9043,
+		0xCBA219A9, 0x84F571B8, 0x550CC98B, 0x1A5BA19A, 0xF23EA45A, 0xBD69CC4B, 0x6C907478, 0x23C71C69,
+		0xB89B624F, 0xF7CC0A5E, 0x2635B26D, 0x6962DA7C, 0x8107DFBC, 0xCE50B7AD, 0x1FA90F9E, 0x50FE678F,
+		0xE5F41C4A, 0xAAA3745B, 0x7B5ACC68, 0x340DA479, 0xDC68A1B9, 0x933FC9A8, 0x42C6719B, 0x0D91198A,
+		0x96CD67AC, 0xD99A0FBD, 0x0863B78E, 0x4734DF9F, 0xAF51DA5F, 0xE006B24E, 0x31FF0A7D, 0x7EA8626C,
+		0x0386EB86, 0x4CD18397, 0x9D283BA4, 0xD27F53B5, 0x3A1A5675, 0x754D3E64, 0xA4B48657, 0xEBE3EE46,
+		0x70BF9060, 0x3FE8F871, 0xEE114042, 0xA1462853, 0x49232D93, 0x06744582, 0xD78DFDB1, 0x98DA95A0,
+		0xB958178C, 0xF60F7F9D, 0x27F6C7AE, 0x68A1AFBF, 0x80C4AA7F, 0xCF93C26E, 0x1E6A7A5D, 0x513D124C,
+		0xCA616C6A, 0x8536047B, 0x54CFBC48, 0x1B98D459, 0xF3FDD199, 0xBCAAB988, 0x6D5301BB, 0x220469AA,
+		0x5F2AE040, 0x107D8851, 0xC1843062, 0x8ED35873, 0x66B65DB3, 0x29E135A2, 0xF8188D91, 0xB74FE580,
+		0x2C139BA6, 0x6344F3B7, 0xB2BD4B84, 0xFDEA2395, 0x158F2655, 0x5AD84E44, 0x8B21F677, 0xC4769E66,
+		0x717CE5A3, 0x3E2B8DB2, 0xEFD23581, 0xA0855D90, 0x48E05850, 0x07B73041, 0xD64E8872, 0x9919E063,
+		0x02459E45, 0x4D12F654, 0x9CEB4E67, 0xD3BC2676, 0x3BD923B6, 0x748E4BA7, 0xA577F394, 0xEA209B85,
+		0x970E126F, 0xD8597A7E, 0x09A0C24D, 0x46F7AA5C, 0xAE92AF9C, 0xE1C5C78D, 0x303C7FBE, 0x7F6B17AF,
+		0xE4376989, 0xAB600198, 0x7A99B9AB, 0x35CED1BA, 0xDDABD47A, 0x92FCBC6B, 0x43050458, 0x0C526C49,
+	},
+	{
+		0x00000000, 0x5BA1DCCA, 0xB743B994, 0xECE2655E, 0x6A466E9F, 0x31E7B255, 0xDD05D70B, 0x86A40BC1,
+		0xD48CDD3E, 0x8F2D01F4, 0x63CF64AA, 0x386EB860, 0xBECAB3A1, 0xE56B6F6B, 0x09890A35, 0x5228D6FF,
+		0xADD8A7CB, 0xF6797B01, 0x1A9B1E5F, 0x413AC295, 0xC79EC954, 0x9C3F159E, 0x70DD70C0, 0x2B7CAC0A,
+		0x79547AF5, 0x22F5A63F, 0xCE17C361, 0x95B61FAB, 0x1312146A, 0x48B3C8A0, 0xA451ADFE, 0xFFF07134,
+		0x5F705221, 0x04D18EEB, 0xE833EBB5, 0xB392377F, 0x35363CBE, 0x6E97E074, 0x8275852A, 0xD9D459E0,
+		0x8BFC8F1F, 0xD05D53D5, 0x3CBF368B, 0x671EEA41, 0xE1BAE180, 0xBA1B3D4A, 0x56F95814, 0x0D5884DE,
+		0xF2A8F5EA, 0xA9092920, 0x45EB4C7E, 0x1E4A90B4, 0x98EE9B75, 0xC34F47BF, 0x2FAD22E1, 0x740CFE2B,
+		0x262428D4, 0x7D85F41E, 0x91679140, 0xCAC64D8A, 0x4C62464B, 0x17C39A81, 0xFB21FFDF, 0xA0802315,
+		0xBEE0A442, 0xE5417888, 0x09A31DD6, 0x5202C11C, 0xD4A6CADD, 0x8F071617, 0x63E57349, 0x3844AF83,
+		0x6A6C797C, 0x31CDA5B6, 0xDD2FC0E8, 0x868E1C22, 0x002A17E3, 0x5B8BCB29, 0xB769AE77, 0xECC872BD,
+		0x13380389, 0x4899DF43, 0xA47BBA1D, 0xFFDA66D7, 0x797E6D16, 0x22DFB1DC, 0xCE3DD482, 0x959C0848,
+		0xC7B4DEB7, 0x9C15027D, 0x70F76723, 0x2B56BBE9, 0xADF2B028, 0xF6536CE2, 0x1AB109BC, 0x4110D576,
+		0xE190F663, 0xBA312AA9, 0x56D34FF7, 0x0D72933D, 0x8BD698FC, 0xD0774436, 0x3C952168, 0x6734FDA2,
+		0x351C2B5D, 0x6EBDF797, 0x825F92C9, 0xD9FE4E03, 0x5F5A45C2, 0x04FB9908, 0xE819FC56, 0xB3B8209C,
+		0x4C4851A8, 0x17E98D62, 0xFB0BE83C, 0xA0AA34F6, 0x260E3F37, 0x7DAFE3FD, 0x914D86A3, 0xCAEC5A69,
+		0x98C48C96, 0xC365505C, 0x2F873502, 0x7426E9C8, 0xF282E209, 0xA9233EC3, 0x45C15B9D, 0x1E608757,
+		0x79005533, 0x22A189F9, 0xCE43ECA7, 0x95E2306D, 0x13463BAC, 0x48E7E766, 0xA4058238, 0xFFA45EF2,
+		0xAD8C880D, 0xF62D54C7, 0x1ACF3199, 0x416EED53, 0xC7CAE692, 0x9C6B3A58, 0x70895F06, 0x2B2883CC,
+		0xD4D8F2F8, 0x8F792E32, 0x639B4B6C, 0x383A97A6, 0xBE9E9C67, 0xE53F40AD, 0x09DD25F3, 0x527CF939,
+		0x00542FC6, 0x5BF5F30C, 0xB7179652, 0xECB64A98, 0x6A124159, 0x31B39D93, 0xDD51F8CD, 0x86F02407,
+		0x26700712, 0x7DD1DBD8, 0x9133BE86, 0xCA92624C, 0x4C36698D, 0x1797B547, 0xFB75D019, 0xA0D40CD3,
+		0xF2FCDA2C, 0xA95D06E6, 0x45BF63B8, 0x1E1EBF72, 0x98BAB4B3, 0xC31B6879, 0x2FF90D27, 0x7458D1ED,
+		0x8BA8A0D9, 0xD0097C13, 0x3CEB194D, 0x674AC587, 0xE1EECE46, 0xBA4F128C, 0x56AD77D2, 0x0D0CAB18,
+		0x5F247DE7, 0x0485A12D, 0xE867C473, 0xB3C618B9, 0x35621378, 0x6EC3CFB2, 0x8221AAEC, 0xD9807626,
+		0xC7E0F171, 0x9C412DBB, 0x70A348E5, 0x2B02942F, 0xADA69FEE, 0xF6074324, 0x1AE5267A, 0x4144FAB0,
+		0x136C2C4F, 0x48CDF085, 0xA42F95DB, 0xFF8E4911, 0x792A42D0, 0x228B9E1A, 0xCE69FB44, 0x95C8278E,
+		0x6A3856BA, 0x31998A70, 0xDD7BEF2E, 0x86DA33E4, 0x007E3825, 0x5BDFE4EF, 0xB73D81B1, 0xEC9C5D7B,
+		0xBEB48B84, 0xE515574E, 0x09F73210, 0x5256EEDA, 0xD4F2E51B, 0x8F5339D1, 0x63B15C8F, 0x38108045,
+		0x9890A350, 0xC3317F9A, 0x2FD31AC4, 0x7472C60E, 0xF2D6CDCF, 0xA9771105, 0x4595745B, 0x1E34A891,
+		0x4C1C7E6E, 0x17BDA2A4, 0xFB5FC7FA, 0xA0FE1B30, 0x265A10F1, 0x7DFBCC3B, 0x9119A965, 0xCAB875AF,
+		0x3548049B, 0x6EE9D851, 0x820BBD0F, 0xD9AA61C5, 0x5F0E6A04, 0x04AFB6CE, 0xE84DD390, 0xB3EC0F5A,
+		0xE1C4D9A5, 0xBA65056F, 0x56876031, 0x0D26BCFB, 0x8B82B73A, 0xD0236BF0, 0x3CC10EAE, 0x6760D264,
+	},
+	{
+		0x00000000, 0xF200AA66, 0xE0C0497B, 0x12C0E31D, 0xC5418F41, 0x37412527, 0x2581C63A, 0xD7816C5C,
+		0x8E420335, 0x7C42A953, 0x6E824A4E, 0x9C82E028, 0x4B038C74, 0xB9032612, 0xABC3C50F, 0x59C36F69,
+		0x18451BDD, 0xEA45B1BB, 0xF88552A6, 0x0A85F8C0, 0xDD04949C, 0x2F043EFA, 0x3DC4DDE7, 0xCFC47781,
+		0x960718E8, 0x6407B28E, 0x76C75193, 0x84C7FBF5, 0x534697A9, 0xA1463DCF, 0xB386DED2, 0x418674B4,
+		0x308A37BA, 0xC28A9DDC, 0xD04A7EC1, 0x224AD4A7, 0xF5CBB8FB, 0x07CB129D, 0x150BF180, 0xE70B5BE6,
+		0xBEC8348F, 0x4CC89EE9, 0x5E087DF4, 0xAC08D792, 0x7B89BBCE, 0x898911A8, 0x9B49F2B5, 0x694958D3,
+		0x28CF2C67, 0xDACF8601, 0xC80F651C, 0x3A0FCF7A, 0xED8EA326, 0x1F8E0940, 0x0D4EEA5D, 0xFF4E403B,
+		0xA68D2F52, 0x548D8534, 0x464D6629, 0xB44DCC4F, 0x63CCA013, 0x91CC0A75, 0x830CE968, 0x710C430E,
+		0x61146F74, 0x9314C512, 0x81D4260F, 0x73D48C69, 0xA455E035, 0x56554A53, 0x4495A94E, 0xB6950328,
+		0xEF566C41, 0x1D56C627, 0x0F96253A, 0xFD968F5C, 0x2A17E300, 0xD8174966, 0xCAD7AA7B, 0x38D7001D,
+		0x795174A9, 0x8B51DECF, 0x99913DD2, 0x6B9197B4, 0xBC10FBE8, 0x4E10518E, 0x5CD0B293, 0xAED018F5,
+		0xF713779C, 0x0513DDFA, 0x17D33EE7, 0xE5D39481, 0x3252F8DD, 0xC05252BB, 0xD292B1A6, 0x20921BC0,
+		0x519E58CE, 0xA39EF2A8, 0xB15E11B5, 0x435EBBD3, 0x94DFD78F, 0x66DF7DE9, 0x741F9EF4, 0x861F3492,
+		0xDFDC5BFB, 0x2DDCF19D, 0x3F1C1280, 0xCD1CB8E6, 0x1A9DD4BA, 0xE89D7EDC, 0xFA5D9DC1, 0x085D37A7,
+		0x49DB4313, 0xBBDBE975, 0xA91B0A68, 0x5B1BA00E, 0x8C9ACC52, 0x7E9A6634, 0x6C5A8529, 0x9E5A2F4F,
+		0xC7994026, 0x3599EA40, 0x2759095D, 0xD559A33B, 0x02D8CF67, 0xF0D86501, 0xE218861C, 0x10182C7A,
+		0xC228DEE8, 0x3028748E, 0x22E89793, 0xD0E83DF5, 0x076951A9, 0xF569FBCF, 0xE7A918D2, 0x15A9B2B4,
+		0x4C6ADDDD, 0xBE6A77BB, 0xACAA94A6, 0x5EAA3EC0, 0x892B529C, 0x7B2BF8FA, 0x69EB1BE7, 0x9BEBB181,
+		0xDA6DC535, 0x286D6F53, 0x3AAD8C4E, 0xC8AD2628, 0x1F2C4A74, 0xED2CE012, 0xFFEC030F, 0x0DECA969,
+		0x542FC600, 0xA62F6C66, 0xB4EF8F7B, 0x46EF251D, 0x916E4941, 0x636EE327, 0x71AE003A, 0x83AEAA5C,
+		0xF2A2E952, 0x00A24334, 0x1262A029, 0xE0620A4F, 0x37E36613, 0xC5E3CC75, 0xD7232F68, 0x2523850E,
+		0x7CE0EA67, 0x8EE04001, 0x9C20A31C, 0x6E20097A, 0xB9A16526, 0x4BA1CF40, 0x59612C5D, 0xAB61863B,
+		0xEAE7F28F, 0x18E758E9, 0x0A27BBF4, 0xF8271192, 0x2FA67DCE, 0xDDA6D7A8, 0xCF6634B5, 0x3D669ED3,
+		0x64A5F1BA, 0x96A55BDC, 0x8465B8C1, 0x766512A7, 0xA1E47EFB, 0x53E4D49D, 0x41243780, 0xB3249DE6,
+		0xA33CB19C, 0x513C1BFA, 0x43FCF8E7, 0xB1FC5281, 0x667D3EDD, 0x947D94BB, 0x86BD77A6, 0x74BDDDC0,
+		0x2D7EB2A9, 0xDF7E18CF, 0xCDBEFBD2, 0x3FBE51B4, 0xE83F3DE8, 0x1A3F978E, 0x08FF7493, 0xFAFFDEF5,
+		0xBB79AA41, 0x49790027, 0x5BB9E33A, 0xA9B9495C, 0x7E382500, 0x8C388F66, 0x9EF86C7B, 0x6CF8C61D,
+		0x353BA974, 0xC73B0312, 0xD5FBE00F, 0x27FB4A69, 0xF07A2635, 0x027A8C53, 0x10BA6F4E, 0xE2BAC528,
+		0x93B68626, 0x61B62C40, 0x7376CF5D, 0x8176653B, 0x56F70967, 0xA4F7A301, 0xB637401C, 0x4437EA7A,
+		0x1DF48513, 0xEFF42F75, 0xFD34CC68, 0x0F34660E, 0xD8B50A52, 0x2AB5A034, 0x38754329, 0xCA75E94F,
+		0x8BF39DFB, 0x79F3379D, 0x6B33D480, 0x99337EE6, 0x4EB212BA, 0xBCB2B8DC, 0xAE725BC1, 0x5C72F1A7,
+		0x05B19ECE, 0xF7B134A8, 0xE571D7B5, 0x17717DD3, 0xC0F0118F, 0x32F0BBE9, 0x203058F4, 0xD230F292,
+	},
+	{
+		0x00000000, 0x8090A067, 0x05E05D79, 0x8570FD1E, 0x0BC0BAF2, 0x8B501A95, 0x0E20E78B, 0x8EB047EC,
+		0x178175E4, 0x9711D583, 0x1261289D, 0x92F188FA, 0x1C41CF16, 0x9CD16F71, 0x19A1926F, 0x99313208,
+		0x2F02EBC8, 0xAF924BAF, 0x2AE2B6B1, 0xAA7216D6, 0x24C2513A, 0xA452F15D, 0x21220C43, 0xA1B2AC24,
+		0x38839E2C, 0xB8133E4B, 0x3D63C355, 0xBDF36332, 0x334324DE, 0xB3D384B9, 0x36A379A7, 0xB633D9C0,
+		0x5E05D790, 0xDE9577F7, 0x5BE58AE9, 0xDB752A8E, 0x55C56D62, 0xD555CD05, 0x5025301B, 0xD0B5907C,
+		0x4984A274, 0xC9140213, 0x4C64FF0D, 0xCCF45F6A, 0x42441886, 0xC2D4B8E1, 0x47A445FF, 0xC734E598,
+		0x71073C58, 0xF1979C3F, 0x74E76121, 0xF477C146, 0x7AC786AA, 0xFA5726CD, 0x7F27DBD3, 0xFFB77BB4,
+		0x668649BC, 0xE616E9DB, 0x636614C5, 0xE3F6B4A2, 0x6D46F34E, 0xEDD65329, 0x68A6AE37, 0xE8360E50,
+		0xBC0BAF20, 0x3C9B0F47, 0xB9EBF259, 0x397B523E, 0xB7CB15D2, 0x375BB5B5, 0xB22B48AB, 0x32BBE8CC,
+		0xAB8ADAC4, 0x2B1A7AA3, 0xAE6A87BD, 0x2EFA27DA, 0xA04A6036, 0x20DAC051, 0xA5AA3D4F, 0x253A9D28,
+		0x930944E8, 0x1399E48F, 0x96E91991, 0x1679B9F6, 0x98C9FE1A, 0x18595E7D, 0x9D29A363, 0x1DB90304,
+		0x8488310C, 0x0418916B, 0x81686C75, 0x01F8CC12, 0x8F488BFE, 0x0FD82B99, 0x8AA8D687, 0x0A3876E0,
+		0xE20E78B0, 0x629ED8D7, 0xE7EE25C9, 0x677E85AE, 0xE9CEC242, 0x695E6225, 0xEC2E9F3B, 0x6CBE3F5C,
+		0xF58F0D54, 0x751FAD33, 0xF06F502D, 0x70FFF04A, 0xFE4FB7A6, 0x7EDF17C1, 0xFBAFEADF, 0x7B3F4AB8,
+		0xCD0C9378, 0x4D9C331F, 0xC8ECCE01, 0x487C6E66, 0xC6CC298A, 0x465C89ED, 0xC32C74F3, 0x43BCD494,
+		0xDA8DE69C, 0x5A1D46FB, 0xDF6DBBE5, 0x5FFD1B82, 0xD14D5C6E, 0x51DDFC09, 0xD4AD0117, 0x543DA170,
+		0x7CD643F7, 0xFC46E390, 0x79361E8E, 0xF9A6BEE9, 0x7716F905, 0xF7865962, 0x72F6A47C, 0xF266041B,
+		0x6B573613, 0xEBC79674, 0x6EB76B6A, 0xEE27CB0D, 0x60978CE1, 0xE0072C86, 0x6577D198, 0xE5E771FF,
+		0x53D4A83F, 0xD3440858, 0x5634F546, 0xD6A45521, 0x581412CD, 0xD884B2AA, 0x5DF44FB4, 0xDD64EFD3,
+		0x4455DDDB, 0xC4C57DBC, 0x41B580A2, 0xC12520C5, 0x4F956729, 0xCF05C74E, 0x4A753A50, 0xCAE59A37,
+		0x22D39467, 0xA2433400, 0x2733C91E, 0xA7A36979, 0x29132E95, 0xA9838EF2, 0x2CF373EC, 0xAC63D38B,
+		0x3552E183, 0xB5C241E4, 0x30B2BCFA, 0xB0221C9D, 0x3E925B71, 0xBE02FB16, 0x3B720608, 0xBBE2A66F,
+		0x0DD17FAF, 0x8D41DFC8, 0x083122D6, 0x88A182B1, 0x0611C55D, 0x8681653A, 0x03F19824, 0x83613843,
+		0x1A500A4B, 0x9AC0AA2C, 0x1FB05732, 0x9F20F755, 0x1190B0B9, 0x910010DE, 0x1470EDC0, 0x94E04DA7,
+		0xC0DDECD7, 0x404D4CB0, 0xC53DB1AE, 0x45AD11C9, 0xCB1D5625, 0x4B8DF642, 0xCEFD0B5C, 0x4E6DAB3B,
+		0xD75C9933, 0x57CC3954, 0xD2BCC44A, 0x522C642D, 0xDC9C23C1, 0x5C0C83A6, 0xD97C7EB8, 0x59ECDEDF,
+		0xEFDF071F, 0x6F4FA778, 0xEA3F5A66, 0x6AAFFA01, 0xE41FBDED, 0x648F1D8A, 0xE1FFE094, 0x616F40F3,
+		0xF85E72FB, 0x78CED29C, 0xFDBE2F82, 0x7D2E8FE5, 0xF39EC809, 0x730E686E, 0xF67E9570, 0x76EE3517,
+		0x9ED83B47, 0x1E489B20, 0x9B38663E, 0x1BA8C659, 0x951881B5, 0x158821D2, 0x90F8DCCC, 0x10687CAB,
+		0x89594EA3, 0x09C9EEC4, 0x8CB913DA, 0x0C29B3BD, 0x8299F451, 0x02095436, 0x8779A928, 0x07E9094F,
+		0xB1DAD08F, 0x314A70E8, 0xB43A8DF6, 0x34AA2D91, 0xBA1A6A7D, 0x3A8ACA1A, 0xBFFA3704, 0x3F6A9763,
+		0xA65BA56B, 0x26CB050C, 0xA3BBF812, 0x232B5875, 0xAD9B1F99, 0x2D0BBFFE, 0xA87B42E0, 0x28EBE287,
+	},
+	{
+		0x00000000, 0xF9AC87EE, 0xF798126B, 0x0E349585, 0xEBF13961, 0x125DBE8F, 0x1C692B0A, 0xE5C5ACE4,
+		0xD3236F75, 0x2A8FE89B, 0x24BB7D1E, 0xDD17FAF0, 0x38D25614, 0xC17ED1FA, 0xCF4A447F, 0x36E6C391,
+		0xA287C35D, 0x5B2B44B3, 0x551FD136, 0xACB356D8, 0x4976FA3C, 0xB0DA7DD2, 0xBEEEE857, 0x47426FB9,
+		0x71A4AC28, 0x88082BC6, 0x863CBE43, 0x7F9039AD, 0x9A559549, 0x63F912A7, 0x6DCD8722, 0x946100CC,
+		0x41CE9B0D, 0xB8621CE3, 0xB6568966, 0x4FFA0E88, 0xAA3FA26C, 0x53932582, 0x5DA7B007, 0xA40B37E9,
+		0x92EDF478, 0x6B417396, 0x6575E613, 0x9CD961FD, 0x791CCD19, 0x80B04AF7, 0x8E84DF72, 0x7728589C,
+		0xE3495850, 0x1AE5DFBE, 0x14D14A3B, 0xED7DCDD5, 0x08B86131, 0xF114E6DF, 0xFF20735A, 0x068CF4B4,
+		0x306A3725, 0xC9C6B0CB, 0xC7F2254E, 0x3E5EA2A0, 0xDB9B0E44, 0x223789AA, 0x2C031C2F, 0xD5AF9BC1,
+		0x839D361A, 0x7A31B1F4, 0x74052471, 0x8DA9A39F, 0x686C0F7B, 0x91C08895, 0x9FF41D10, 0x66589AFE,
+		0x50BE596F, 0xA912DE81, 0xA7264B04, 0x5E8ACCEA, 0xBB4F600E, 0x42E3E7E0, 0x4CD77265, 0xB57BF58B,
+		0x211AF547, 0xD8B672A9, 0xD682E72C, 0x2F2E60C2, 0xCAEBCC26, 0x33474BC8, 0x3D73DE4D, 0xC4DF59A3,
+		0xF2399A32, 0x0B951DDC, 0x05A18859, 0xFC0D0FB7, 0x19C8A353, 0xE06424BD, 0xEE50B138, 0x17FC36D6,
+		0xC253AD17, 0x3BFF2AF9, 0x35CBBF7C, 0xCC673892, 0x29A29476, 0xD00E1398, 0xDE3A861D, 0x279601F3,
+		0x1170C262, 0xE8DC458C, 0xE6E8D009, 0x1F4457E7, 0xFA81FB03, 0x032D7CED, 0x0D19E968, 0xF4B56E86,
+		0x60D46E4A, 0x9978E9A4, 0x974C7C21, 0x6EE0FBCF, 0x8B25572B, 0x7289D0C5, 0x7CBD4540, 0x8511C2AE,
+		0xB3F7013F, 0x4A5B86D1, 0x446F1354, 0xBDC394BA, 0x5806385E, 0xA1AABFB0, 0xAF9E2A35, 0x5632ADDB,
+		0x03FB7183, 0xFA57F66D, 0xF46363E8, 0x0DCFE406, 0xE80A48E2, 0x11A6CF0C, 0x1F925A89, 0xE63EDD67,
+		0xD0D81EF6, 0x29749918, 0x27400C9D, 0xDEEC8B73, 0x3B292797, 0xC285A079, 0xCCB135FC, 0x351DB212,
+		0xA17CB2DE, 0x58D03530, 0x56E4A0B5, 0xAF48275B, 0x4A8D8BBF, 0xB3210C51, 0xBD1599D4, 0x44B91E3A,
+		0x725FDDAB, 0x8BF35A45, 0x85C7CFC0, 0x7C6B482E, 0x99AEE4CA, 0x60026324, 0x6E36F6A1, 0x979A714F,
+		0x4235EA8E, 0xBB996D60, 0xB5ADF8E5, 0x4C017F0B, 0xA9C4D3EF, 0x50685401, 0x5E5CC184, 0xA7F0466A,
+		0x911685FB, 0x68BA0215, 0x668E9790, 0x9F22107E, 0x7AE7BC9A, 0x834B3B74, 0x8D7FAEF1, 0x74D3291F,
+		0xE0B229D3, 0x191EAE3D, 0x172A3BB8, 0xEE86BC56, 0x0B4310B2, 0xF2EF975C, 0xFCDB02D9, 0x05778537,
+		0x339146A6, 0xCA3DC148, 0xC40954CD, 0x3DA5D323, 0xD8607FC7, 0x21CCF829, 0x2FF86DAC, 0xD654EA42,
+		0x80664799, 0x79CAC077, 0x77FE55F2, 0x8E52D21C, 0x6B977EF8, 0x923BF916, 0x9C0F6C93, 0x65A3EB7D,
+		0x534528EC, 0xAAE9AF02, 0xA4DD3A87, 0x5D71BD69, 0xB8B4118D, 0x41189663, 0x4F2C03E6, 0xB6808408,
+		0x22E184C4, 0xDB4D032A, 0xD57996AF, 0x2CD51141, 0xC910BDA5, 0x30BC3A4B, 0x3E88AFCE, 0xC7242820,
+		0xF1C2EBB1, 0x086E6C5F, 0x065AF9DA, 0xFFF67E34, 0x1A33D2D0, 0xE39F553E, 0xEDABC0BB, 0x14074755,
+		0xC1A8DC94, 0x38045B7A, 0x3630CEFF, 0xCF9C4911, 0x2A59E5F5, 0xD3F5621B, 0xDDC1F79E, 0x246D7070,
+		0x128BB3E1, 0xEB27340F, 0xE513A18A, 0x1CBF2664, 0xF97A8A80, 0x00D60D6E, 0x0EE298EB, 0xF74E1F05,
+		0x632F1FC9, 0x9A839827, 0x94B70DA2, 0x6D1B8A4C, 0x88DE26A8, 0x7172A146, 0x7F4634C3, 0x86EAB32D,
+		0xB00C70BC, 0x49A0F752, 0x479462D7, 0xBE38E539, 0x5BFD49DD, 0xA251CE33, 0xAC655BB6, 0x55C9DC58,
+	},
+	{
+		0x00000000, 0x07F6E306, 0x0FEDC60C, 0x081B250A, 0x1FDB8C18, 0x182D6F1E, 0x10364A14, 0x17C0A912,
+		0x3FB71830, 0x3841FB36, 0x305ADE3C, 0x37AC3D3A, 0x206C9428, 0x279A772E, 0x2F815224, 0x2877B122,
+		0x7F6E3060, 0x7898D366, 0x7083F66C, 0x7775156A, 0x60B5BC78, 0x67435F7E, 0x6F587A74, 0x68AE9972,
+		0x40D92850, 0x472FCB56, 0x4F34EE5C, 0x48C20D5A, 0x5F02A448, 0x58F4474E, 0x50EF6244, 0x57198142,
+		0xFEDC60C0, 0xF92A83C6, 0xF131A6CC, 0xF6C745CA, 0xE107ECD8, 0xE6F10FDE, 0xEEEA2AD4, 0xE91CC9D2,
+		0xC16B78F0, 0xC69D9BF6, 0xCE86BEFC, 0xC9705DFA, 0xDEB0F4E8, 0xD94617EE, 0xD15D32E4, 0xD6ABD1E2,
+		0x81B250A0, 0x8644B3A6, 0x8E5F96AC, 0x89A975AA, 0x9E69DCB8, 0x999F3FBE, 0x91841AB4, 0x9672F9B2,
+		0xBE054890, 0xB9F3AB96, 0xB1E88E9C, 0xB61E6D9A, 0xA1DEC488, 0xA628278E, 0xAE330284, 0xA9C5E182,
+		0xF979DC37, 0xFE8F3F31, 0xF6941A3B, 0xF162F93D, 0xE6A2502F, 0xE154B329, 0xE94F9623, 0xEEB97525,
+		0xC6CEC407, 0xC1382701, 0xC923020B, 0xCED5E10D, 0xD915481F, 0xDEE3AB19, 0xD6F88E13, 0xD10E6D15,
+		0x8617EC57, 0x81E10F51, 0x89FA2A5B, 0x8E0CC95D, 0x99CC604F, 0x9E3A8349, 0x9621A643, 0x91D74545,
+		0xB9A0F467, 0xBE561761, 0xB64D326B, 0xB1BBD16D, 0xA67B787F, 0xA18D9B79, 0xA996BE73, 0xAE605D75,
+		0x07A5BCF7, 0x00535FF1, 0x08487AFB, 0x0FBE99FD, 0x187E30EF, 0x1F88D3E9, 0x1793F6E3, 0x106515E5,
+		0x3812A4C7, 0x3FE447C1, 0x37FF62CB, 0x300981CD, 0x27C928DF, 0x203FCBD9, 0x2824EED3, 0x2FD20DD5,
+		0x78CB8C97, 0x7F3D6F91, 0x77264A9B, 0x70D0A99D, 0x6710008F, 0x60E6E389, 0x68FDC683, 0x6F0B2585,
+		0x477C94A7, 0x408A77A1, 0x489152AB, 0x4F67B1AD, 0x58A718BF, 0x5F51FBB9, 0x574ADEB3, 0x50BC3DB5,
+		0xF632A5D9, 0xF1C446DF, 0xF9DF63D5, 0xFE2980D3, 0xE9E929C1, 0xEE1FCAC7, 0xE604EFCD, 0xE1F20CCB,
+		0xC985BDE9, 0xCE735EEF, 0xC6687BE5, 0xC19E98E3, 0xD65E31F1, 0xD1A8D2F7, 0xD9B3F7FD, 0xDE4514FB,
+		0x895C95B9, 0x8EAA76BF, 0x86B153B5, 0x8147B0B3, 0x968719A1, 0x9171FAA7, 0x996ADFAD, 0x9E9C3CAB,
+		0xB6EB8D89, 0xB11D6E8F, 0xB9064B85, 0xBEF0A883, 0xA9300191, 0xAEC6E297, 0xA6DDC79D, 0xA12B249B,
+		0x08EEC519, 0x0F18261F, 0x07030315, 0x00F5E013, 0x17354901, 0x10C3AA07, 0x18D88F0D, 0x1F2E6C0B,
+		0x3759DD29, 0x30AF3E2F, 0x38B41B25, 0x3F42F823, 0x28825131, 0x2F74B237, 0x276F973D, 0x2099743B,
+		0x7780F579, 0x7076167F, 0x786D3375, 0x7F9BD073, 0x685B7961, 0x6FAD9A67, 0x67B6BF6D, 0x60405C6B,
+		0x4837ED49, 0x4FC10E4F, 0x47DA2B45, 0x402CC843, 0x57EC6151, 0x501A8257, 0x5801A75D, 0x5FF7445B,
+		0x0F4B79EE, 0x08BD9AE8, 0x00A6BFE2, 0x07505CE4, 0x1090F5F6, 0x176616F0, 0x1F7D33FA, 0x188BD0FC,
+		0x30FC61DE, 0x370A82D8, 0x3F11A7D2, 0x38E744D4, 0x2F27EDC6, 0x28D10EC0, 0x20CA2BCA, 0x273CC8CC,
+		0x7025498E, 0x77D3AA88, 0x7FC88F82, 0x783E6C84, 0x6FFEC596, 0x68082690, 0x6013039A, 0x67E5E09C,
+		0x4F9251BE, 0x4864B2B8, 0x407F97B2, 0x478974B4, 0x5049DDA6, 0x57BF3EA0, 0x5FA41BAA, 0x5852F8AC,
+		0xF197192E, 0xF661FA28, 0xFE7ADF22, 0xF98C3C24, 0xEE4C9536, 0xE9BA7630, 0xE1A1533A, 0xE657B03C,
+		0xCE20011E, 0xC9D6E218, 0xC1CDC712, 0xC63B2414, 0xD1FB8D06, 0xD60D6E00, 0xDE164B0A, 0xD9E0A80C,
+		0x8EF9294E, 0x890FCA48, 0x8114EF42, 0x86E20C44, 0x9122A556, 0x96D44650, 0x9ECF635A, 0x9939805C,
+		0xB14E317E, 0xB6B8D278, 0xBEA3F772, 0xB9551474, 0xAE95BD66, 0xA9635E60, 0xA1787B6A, 0xA68E986C,
+	},
+	{
+		0x00000000, 0xE8A45605, 0xD589B1BD, 0x3D2DE7B8, 0xAFD27ECD, 0x477628C8, 0x7A5BCF70, 0x92FF9975,
+		0x5B65E02D, 0xB3C1B628, 0x8EEC5190, 0x66480795, 0xF4B79EE0, 0x1C13C8E5, 0x213E2F5D, 0xC99A7958,
+		0xB6CBC05A, 0x5E6F965F, 0x634271E7, 0x8BE627E2, 0x1919BE97, 0xF1BDE892, 0xCC900F2A, 0x2434592F,
+		0xEDAE2077, 0x050A7672, 0x382791CA, 0xD083C7CF, 0x427C5EBA, 0xAAD808BF, 0x97F5EF07, 0x7F51B902,
+		0x69569D03, 0x81F2CB06, 0xBCDF2CBE, 0x547B7ABB, 0xC684E3CE, 0x2E20B5CB, 0x130D5273, 0xFBA90476,
+		0x32337D2E, 0xDA972B2B, 0xE7BACC93, 0x0F1E9A96, 0x9DE103E3, 0x754555E6, 0x4868B25E, 0xA0CCE45B,
+		0xDF9D5D59, 0x37390B5C, 0x0A14ECE4, 0xE2B0BAE1, 0x704F2394, 0x98EB7591, 0xA5C69229, 0x4D62C42C,
+		0x84F8BD74, 0x6C5CEB71, 0x51710CC9, 0xB9D55ACC, 0x2B2AC3B9, 0xC38E95BC, 0xFEA37204, 0x16072401,
+		0xD2AD3A06, 0x3A096C03, 0x07248BBB, 0xEF80DDBE, 0x7D7F44CB, 0x95DB12CE, 0xA8F6F576, 0x4052A373,
+		0x89C8DA2B, 0x616C8C2E, 0x5C416B96, 0xB4E53D93, 0x261AA4E6, 0xCEBEF2E3, 0xF393155B, 0x1B37435E,
+		0x6466FA5C, 0x8CC2AC59, 0xB1EF4BE1, 0x594B1DE4, 0xCBB48491, 0x2310D294, 0x1E3D352C, 0xF6996329,
+		0x3F031A71, 0xD7A74C74, 0xEA8AABCC, 0x022EFDC9, 0x90D164BC, 0x787532B9, 0x4558D501, 0xADFC8304,
+		0xBBFBA705, 0x535FF100, 0x6E7216B8, 0x86D640BD, 0x1429D9C8, 0xFC8D8FCD, 0xC1A06875, 0x29043E70,
+		0xE09E4728, 0x083A112D, 0x3517F695, 0xDDB3A090, 0x4F4C39E5, 0xA7E86FE0, 0x9AC58858, 0x7261DE5D,
+		0x0D30675F, 0xE594315A, 0xD8B9D6E2, 0x301D80E7, 0xA2E21992, 0x4A464F97, 0x776BA82F, 0x9FCFFE2A,
+		0x56558772, 0xBEF1D177, 0x83DC36CF, 0x6B7860CA, 0xF987F9BF, 0x1123AFBA, 0x2C0E4802, 0xC4AA1E07,
+		0xA19B69BB, 0x493F3FBE, 0x7412D806, 0x9CB68E03, 0x0E491776, 0xE6ED4173, 0xDBC0A6CB, 0x3364F0CE,
+		0xFAFE8996, 0x125ADF93, 0x2F77382B, 0xC7D36E2E, 0x552CF75B, 0xBD88A15E, 0x80A546E6, 0x680110E3,
+		0x1750A9E1, 0xFFF4FFE4, 0xC2D9185C, 0x2A7D4E59, 0xB882D72C, 0x50268129, 0x6D0B6691, 0x85AF3094,
+		0x4C3549CC, 0xA4911FC9, 0x99BCF871, 0x7118AE74, 0xE3E73701, 0x0B436104, 0x366E86BC, 0xDECAD0B9,
+		0xC8CDF4B8, 0x2069A2BD, 0x1D444505, 0xF5E01300, 0x671F8A75, 0x8FBBDC70, 0xB2963BC8, 0x5A326DCD,
+		0x93A81495, 0x7B0C4290, 0x4621A528, 0xAE85F32D, 0x3C7A6A58, 0xD4DE3C5D, 0xE9F3DBE5, 0x01578DE0,
+		0x7E0634E2, 0x96A262E7, 0xAB8F855F, 0x432BD35A, 0xD1D44A2F, 0x39701C2A, 0x045DFB92, 0xECF9AD97,
+		0x2563D4CF, 0xCDC782CA, 0xF0EA6572, 0x184E3377, 0x8AB1AA02, 0x6215FC07, 0x5F381BBF, 0xB79C4DBA,
+		0x733653BD, 0x9B9205B8, 0xA6BFE200, 0x4E1BB405, 0xDCE42D70, 0x34407B75, 0x096D9CCD, 0xE1C9CAC8,
+		0x2853B390, 0xC0F7E595, 0xFDDA022D, 0x157E5428, 0x8781CD5D, 0x6F259B58, 0x52087CE0, 0xBAAC2AE5,
+		0xC5FD93E7, 0x2D59C5E2, 0x1074225A, 0xF8D0745F, 0x6A2FED2A, 0x828BBB2F, 0xBFA65C97, 0x57020A92,
+		0x9E9873CA, 0x763C25CF, 0x4B11C277, 0xA3B59472, 0x314A0D07, 0xD9EE5B02, 0xE4C3BCBA, 0x0C67EABF,
+		0x1A60CEBE, 0xF2C498BB, 0xCFE97F03, 0x274D2906, 0xB5B2B073, 0x5D16E676, 0x603B01CE, 0x889F57CB,
+		0x41052E93, 0xA9A17896, 0x948C9F2E, 0x7C28C92B, 0xEED7505E, 0x0673065B, 0x3B5EE1E3, 0xD3FAB7E6,
+		0xACAB0EE4, 0x440F58E1, 0x7922BF59, 0x9186E95C, 0x03797029, 0xEBDD262C, 0xD6F0C194, 0x3E549791,
+		0xF7CEEEC9, 0x1F6AB8CC, 0x22475F74, 0xCAE30971, 0x581C9004, 0xB0B8C601, 0x8D9521B9, 0x653177BC,
+	},
+	{
+		0x00000000, 0x47F7CEC1, 0x8FEF9D82, 0xC8185343, 0x1B1E26B3, 0x5CE9E872, 0x94F1BB31, 0xD30675F0,
+		0x363C4D66, 0x71CB83A7, 0xB9D3D0E4, 0xFE241E25, 0x2D226BD5, 0x6AD5A514, 0xA2CDF657, 0xE53A3896,
+		0x6C789ACC, 0x2B8F540D, 0xE397074E, 0xA460C98F, 0x7766BC7F, 0x309172BE, 0xF88921FD, 0xBF7EEF3C,
+		0x5A44D7AA, 0x1DB3196B, 0xD5AB4A28, 0x925C84E9, 0x415AF119, 0x06AD3FD8, 0xCEB56C9B, 0x8942A25A,
+		0xD8F13598, 0x9F06FB59, 0x571EA81A, 0x10E966DB, 0xC3EF132B, 0x8418DDEA, 0x4C008EA9, 0x0BF74068,
+		0xEECD78FE, 0xA93AB63F, 0x6122E57C, 0x26D52BBD, 0xF5D35E4D, 0xB224908C, 0x7A3CC3CF, 0x3DCB0D0E,
+		0xB489AF54, 0xF37E6195, 0x3B6632D6, 0x7C91FC17, 0xAF9789E7, 0xE8604726, 0x20781465, 0x678FDAA4,
+		0x82B5E232, 0xC5422CF3, 0x0D5A7FB0, 0x4AADB171, 0x99ABC481, 0xDE5C0A40, 0x16445903, 0x51B397C2,
+		0xB5237687, 0xF2D4B846, 0x3ACCEB05, 0x7D3B25C4, 0xAE3D5034, 0xE9CA9EF5, 0x21D2CDB6, 0x66250377,
+		0x831F3BE1, 0xC4E8F520, 0x0CF0A663, 0x4B0768A2, 0x98011D52, 0xDFF6D393, 0x17EE80D0, 0x50194E11,
+		0xD95BEC4B, 0x9EAC228A, 0x56B471C9, 0x1143BF08, 0xC245CAF8, 0x85B20439, 0x4DAA577A, 0x0A5D99BB,
+		0xEF67A12D, 0xA8906FEC, 0x60883CAF, 0x277FF26E, 0xF479879E, 0xB38E495F, 0x7B961A1C, 0x3C61D4DD,
+		0x6DD2431F, 0x2A258DDE, 0xE23DDE9D, 0xA5CA105C, 0x76CC65AC, 0x313BAB6D, 0xF923F82E, 0xBED436EF,
+		0x5BEE0E79, 0x1C19C0B8, 0xD40193FB, 0x93F65D3A, 0x40F028CA, 0x0707E60B, 0xCF1FB548, 0x88E87B89,
+		0x01AAD9D3, 0x465D1712, 0x8E454451, 0xC9B28A90, 0x1AB4FF60, 0x5D4331A1, 0x955B62E2, 0xD2ACAC23,
+		0x379694B5, 0x70615A74, 0xB8790937, 0xFF8EC7F6, 0x2C88B206, 0x6B7F7CC7, 0xA3672F84, 0xE490E145,
+		0x6E87F0B9, 0x29703E78, 0xE1686D3B, 0xA69FA3FA, 0x7599D60A, 0x326E18CB, 0xFA764B88, 0xBD818549,
+		0x58BBBDDF, 0x1F4C731E, 0xD754205D, 0x90A3EE9C, 0x43A59B6C, 0x045255AD, 0xCC4A06EE, 0x8BBDC82F,
+		0x02FF6A75, 0x4508A4B4, 0x8D10F7F7, 0xCAE73936, 0x19E14CC6, 0x5E168207, 0x960ED144, 0xD1F91F85,
+		0x34C32713, 0x7334E9D2, 0xBB2CBA91, 0xFCDB7450, 0x2FDD01A0, 0x682ACF61, 0xA0329C22, 0xE7C552E3,
+		0xB676C521, 0xF1810BE0, 0x399958A3, 0x7E6E9662, 0xAD68E392, 0xEA9F2D53, 0x22877E10, 0x6570B0D1,
+		0x804A8847, 0xC7BD4686, 0x0FA515C5, 0x4852DB04, 0x9B54AEF4, 0xDCA36035, 0x14BB3376, 0x534CFDB7,
+		0xDA0E5FED, 0x9DF9912C, 0x55E1C26F, 0x12160CAE, 0xC110795E, 0x86E7B79F, 0x4EFFE4DC, 0x09082A1D,
+		0xEC32128B, 0xABC5DC4A, 0x63DD8F09, 0x242A41C8, 0xF72C3438, 0xB0DBFAF9, 0x78C3A9BA, 0x3F34677B,
+		0xDBA4863E, 0x9C5348FF, 0x544B1BBC, 0x13BCD57D, 0xC0BAA08D, 0x874D6E4C, 0x4F553D0F, 0x08A2F3CE,
+		0xED98CB58, 0xAA6F0599, 0x627756DA, 0x2580981B, 0xF686EDEB, 0xB171232A, 0x79697069, 0x3E9EBEA8,
+		0xB7DC1CF2, 0xF02BD233, 0x38338170, 0x7FC44FB1, 0xACC23A41, 0xEB35F480, 0x232DA7C3, 0x64DA6902,
+		0x81E05194, 0xC6179F55, 0x0E0FCC16, 0x49F802D7, 0x9AFE7727, 0xDD09B9E6, 0x1511EAA5, 0x52E62464,
+		0x0355B3A6, 0x44A27D67, 0x8CBA2E24, 0xCB4DE0E5, 0x184B9515, 0x5FBC5BD4, 0x97A40897, 0xD053C656,
+		0x3569FEC0, 0x729E3001, 0xBA866342, 0xFD71AD83, 0x2E77D873, 0x698016B2, 0xA19845F1, 0xE66F8B30,
+		0x6F2D296A, 0x28DAE7AB, 0xE0C2B4E8, 0xA7357A29, 0x74330FD9, 0x33C4C118, 0xFBDC925B, 0xBC2B5C9A,
+		0x5911640C, 0x1EE6AACD, 0xD6FEF98E, 0x9109374F, 0x420F42BF, 0x05F88C7E, 0xCDE0DF3D, 0x8A1711FC,
+	},
+	{
+		0x00000000, 0xDD0FE172, 0xBEDEDF53, 0x63D13E21, 0x797CA311, 0xA4734263, 0xC7A27C42, 0x1AAD9D30,
+		0xF2F94622, 0x2FF6A750, 0x4C279971, 0x91287803, 0x8B85E533, 0x568A0441, 0x355B3A60, 0xE854DB12,
+		0xE13391F3, 0x3C3C7081, 0x5FED4EA0, 0x82E2AFD2, 0x984F32E2, 0x4540D390, 0x2691EDB1, 0xFB9E0CC3,
+		0x13CAD7D1, 0xCEC536A3, 0xAD140882, 0x701BE9F0, 0x6AB674C0, 0xB7B995B2, 0xD468AB93, 0x09674AE1,
+		0xC6A63E51, 0x1BA9DF23, 0x7878E102, 0xA5770070, 0xBFDA9D40, 0x62D57C32, 0x01044213, 0xDC0BA361,
+		0x345F7873, 0xE9509901, 0x8A81A720, 0x578E4652, 0x4D23DB62, 0x902C3A10, 0xF3FD0431, 0x2EF2E543,
+		0x2795AFA2, 0xFA9A4ED0, 0x994B70F1, 0x44449183, 0x5EE90CB3, 0x83E6EDC1, 0xE037D3E0, 0x3D383292,
+		0xD56CE980, 0x086308F2, 0x6BB236D3, 0xB6BDD7A1, 0xAC104A91, 0x711FABE3, 0x12CE95C2, 0xCFC174B0,
+		0x898D6115, 0x54828067, 0x3753BE46, 0xEA5C5F34, 0xF0F1C204, 0x2DFE2376, 0x4E2F1D57, 0x9320FC25,
+		0x7B742737, 0xA67BC645, 0xC5AAF864, 0x18A51916, 0x02088426, 0xDF076554, 0xBCD65B75, 0x61D9BA07,
+		0x68BEF0E6, 0xB5B11194, 0xD6602FB5, 0x0B6FCEC7, 0x11C253F7, 0xCCCDB285, 0xAF1C8CA4, 0x72136DD6,
+		0x9A47B6C4, 0x474857B6, 0x24996997, 0xF99688E5, 0xE33B15D5, 0x3E34F4A7, 0x5DE5CA86, 0x80EA2BF4,
+		0x4F2B5F44, 0x9224BE36, 0xF1F58017, 0x2CFA6165, 0x3657FC55, 0xEB581D27, 0x88892306, 0x5586C274,
+		0xBDD21966, 0x60DDF814, 0x030CC635, 0xDE032747, 0xC4AEBA77, 0x19A15B05, 0x7A706524, 0xA77F8456,
+		0xAE18CEB7, 0x73172FC5, 0x10C611E4, 0xCDC9F096, 0xD7646DA6, 0x0A6B8CD4, 0x69BAB2F5, 0xB4B55387,
+		0x5CE18895, 0x81EE69E7, 0xE23F57C6, 0x3F30B6B4, 0x259D2B84, 0xF892CAF6, 0x9B43F4D7, 0x464C15A5,
+		0x17DBDF9D, 0xCAD43EEF, 0xA90500CE, 0x740AE1BC, 0x6EA77C8C, 0xB3A89DFE, 0xD079A3DF, 0x0D7642AD,
+		0xE52299BF, 0x382D78CD, 0x5BFC46EC, 0x86F3A79E, 0x9C5E3AAE, 0x4151DBDC, 0x2280E5FD, 0xFF8F048F,
+		0xF6E84E6E, 0x2BE7AF1C, 0x4836913D, 0x9539704F, 0x8F94ED7F, 0x529B0C0D, 0x314A322C, 0xEC45D35E,
+		0x0411084C, 0xD91EE93E, 0xBACFD71F, 0x67C0366D, 0x7D6DAB5D, 0xA0624A2F, 0xC3B3740E, 0x1EBC957C,
+		0xD17DE1CC, 0x0C7200BE, 0x6FA33E9F, 0xB2ACDFED, 0xA80142DD, 0x750EA3AF, 0x16DF9D8E, 0xCBD07CFC,
+		0x2384A7EE, 0xFE8B469C, 0x9D5A78BD, 0x405599CF, 0x5AF804FF, 0x87F7E58D, 0xE426DBAC, 0x39293ADE,
+		0x304E703F, 0xED41914D, 0x8E90AF6C, 0x539F4E1E, 0x4932D32E, 0x943D325C, 0xF7EC0C7D, 0x2AE3ED0F,
+		0xC2B7361D, 0x1FB8D76F, 0x7C69E94E, 0xA166083C, 0xBBCB950C, 0x66C4747E, 0x05154A5F, 0xD81AAB2D,
+		0x9E56BE88, 0x43595FFA, 0x208861DB, 0xFD8780A9, 0xE72A1D99, 0x3A25FCEB, 0x59F4C2CA, 0x84FB23B8,
+		0x6CAFF8AA, 0xB1A019D8, 0xD27127F9, 0x0F7EC68B, 0x15D35BBB, 0xC8DCBAC9, 0xAB0D84E8, 0x7602659A,
+		0x7F652F7B, 0xA26ACE09, 0xC1BBF028, 0x1CB4115A, 0x06198C6A, 0xDB166D18, 0xB8C75339, 0x65C8B24B,
+		0x8D9C6959, 0x5093882B, 0x3342B60A, 0xEE4D5778, 0xF4E0CA48, 0x29EF2B3A, 0x4A3E151B, 0x9731F469,
+		0x58F080D9, 0x85FF61AB, 0xE62E5F8A, 0x3B21BEF8, 0x218C23C8, 0xFC83C2BA, 0x9F52FC9B, 0x425D1DE9,
+		0xAA09C6FB, 0x77062789, 0x14D719A8, 0xC9D8F8DA, 0xD37565EA, 0x0E7A8498, 0x6DABBAB9, 0xB0A45BCB,
+		0xB9C3112A, 0x64CCF058, 0x071DCE79, 0xDA122F0B, 0xC0BFB23B, 0x1DB05349, 0x7E616D68, 0xA36E8C1A,
+		0x4B3A5708, 0x9635B67A, 0xF5E4885B, 0x28EB6929, 0x3246F419, 0xEF49156B, 0x8C982B4A, 0x5197CA38,
+	},
+	{
+		0x00000000, 0x2FB7BF3A, 0x5F6F7E74, 0x70D8C14E, 0xBEDEFCE8, 0x916943D2, 0xE1B1829C, 0xCE063DA6,
+		0x797CE467, 0x56CB5B5D, 0x26139A13, 0x09A42529, 0xC7A2188F, 0xE815A7B5, 0x98CD66FB, 0xB77AD9C1,
+		0xF2F9C8CE, 0xDD4E77F4, 0xAD96B6BA, 0x82210980, 0x4C273426, 0x63908B1C, 0x13484A52, 0x3CFFF568,
+		0x8B852CA9, 0xA4329393, 0xD4EA52DD, 0xFB5DEDE7, 0x355BD041, 0x1AEC6F7B, 0x6A34AE35, 0x4583110F,
+		0xE1328C2B, 0xCE853311, 0xBE5DF25F, 0x91EA4D65, 0x5FEC70C3, 0x705BCFF9, 0x00830EB7, 0x2F34B18D,
+		0x984E684C, 0xB7F9D776, 0xC7211638, 0xE896A902, 0x269094A4, 0x09272B9E, 0x79FFEAD0, 0x564855EA,
+		0x13CB44E5, 0x3C7CFBDF, 0x4CA43A91, 0x631385AB, 0xAD15B80D, 0x82A20737, 0xF27AC679, 0xDDCD7943,
+		0x6AB7A082, 0x45001FB8, 0x35D8DEF6, 0x1A6F61CC, 0xD4695C6A, 0xFBDEE350, 0x8B06221E, 0xA4B19D24,
+		0xC6A405E1, 0xE913BADB, 0x99CB7B95, 0xB67CC4AF, 0x787AF909, 0x57CD4633, 0x2715877D, 0x08A23847,
+		0xBFD8E186, 0x906F5EBC, 0xE0B79FF2, 0xCF0020C8, 0x01061D6E, 0x2EB1A254, 0x5E69631A, 0x71DEDC20,
+		0x345DCD2F, 0x1BEA7215, 0x6B32B35B, 0x44850C61, 0x8A8331C7, 0xA5348EFD, 0xD5EC4FB3, 0xFA5BF089,
+		0x4D212948, 0x62969672, 0x124E573C, 0x3DF9E806, 0xF3FFD5A0, 0xDC486A9A, 0xAC90ABD4, 0x832714EE,
+		0x279689CA, 0x082136F0, 0x78F9F7BE, 0x574E4884, 0x99487522, 0xB6FFCA18, 0xC6270B56, 0xE990B46C,
+		0x5EEA6DAD, 0x715DD297, 0x018513D9, 0x2E32ACE3, 0xE0349145, 0xCF832E7F, 0xBF5BEF31, 0x90EC500B,
+		0xD56F4104, 0xFAD8FE3E, 0x8A003F70, 0xA5B7804A, 0x6BB1BDEC, 0x440602D6, 0x34DEC398, 0x1B697CA2,
+		0xAC13A563, 0x83A41A59, 0xF37CDB17, 0xDCCB642D, 0x12CD598B, 0x3D7AE6B1, 0x4DA227FF, 0x621598C5,
+		0x89891675, 0xA63EA94F, 0xD6E66801, 0xF951D73B, 0x3757EA9D, 0x18E055A7, 0x683894E9, 0x478F2BD3,
+		0xF0F5F212, 0xDF424D28, 0xAF9A8C66, 0x802D335C, 0x4E2B0EFA, 0x619CB1C0, 0x1144708E, 0x3EF3CFB4,
+		0x7B70DEBB, 0x54C76181, 0x241FA0CF, 0x0BA81FF5, 0xC5AE2253, 0xEA199D69, 0x9AC15C27, 0xB576E31D,
+		0x020C3ADC, 0x2DBB85E6, 0x5D6344A8, 0x72D4FB92, 0xBCD2C634, 0x9365790E, 0xE3BDB840, 0xCC0A077A,
+		0x68BB9A5E, 0x470C2564, 0x37D4E42A, 0x18635B10, 0xD66566B6, 0xF9D2D98C, 0x890A18C2, 0xA6BDA7F8,
+		0x11C77E39, 0x3E70C103, 0x4EA8004D, 0x611FBF77, 0xAF1982D1, 0x80AE3DEB, 0xF076FCA5, 0xDFC1439F,
+		0x9A425290, 0xB5F5EDAA, 0xC52D2CE4, 0xEA9A93DE, 0x249CAE78, 0x0B2B1142, 0x7BF3D00C, 0x54446F36,
+		0xE33EB6F7, 0xCC8909CD, 0xBC51C883, 0x93E677B9, 0x5DE04A1F, 0x7257F525, 0x028F346B, 0x2D388B51,
+		0x4F2D1394, 0x609AACAE, 0x10426DE0, 0x3FF5D2DA, 0xF1F3EF7C, 0xDE445046, 0xAE9C9108, 0x812B2E32,
+		0x3651F7F3, 0x19E648C9, 0x693E8987, 0x468936BD, 0x888F0B1B, 0xA738B421, 0xD7E0756F, 0xF857CA55,
+		0xBDD4DB5A, 0x92636460, 0xE2BBA52E, 0xCD0C1A14, 0x030A27B2, 0x2CBD9888, 0x5C6559C6, 0x73D2E6FC,
+		0xC4A83F3D, 0xEB1F8007, 0x9BC74149, 0xB470FE73, 0x7A76C3D5, 0x55C17CEF, 0x2519BDA1, 0x0AAE029B,
+		0xAE1F9FBF, 0x81A82085, 0xF170E1CB, 0xDEC75EF1, 0x10C16357, 0x3F76DC6D, 0x4FAE1D23, 0x6019A219,
+		0xD7637BD8, 0xF8D4C4E2, 0x880C05AC, 0xA7BBBA96, 0x69BD8730, 0x460A380A, 0x36D2F944, 0x1965467E,
+		0x5CE65771, 0x7351E84B, 0x03892905, 0x2C3E963F, 0xE238AB99, 0xCD8F14A3, 0xBD57D5ED, 0x92E06AD7,
+		0x259AB316, 0x0A2D0C2C, 0x7AF5CD62, 0x55427258, 0x9B444FFE, 0xB4F3F0C4, 0xC42B318A, 0xEB9C8EB0,
+	},
+};
+
+uint32_t ts_crc32::update_slice16(uint32_t crc, const uint8_t *p, const uint8_t *tail)
+{
+	const uint32_t (*t)[256] = crc_slice;
+
+	while (p + 16 <= tail) {
+		uint32_t w = crc ^ ((static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+		                    (static_cast<uint32_t>(p[2]) << 8) | p[3]);
+		crc = t[15][w >> 24] ^ t[14][(w >> 16) & 0xff] ^ t[13][(w >> 8) & 0xff] ^ t[12][w & 0xff] ^
+		      t[11][p[4]] ^ t[10][p[5]] ^ t[9][p[6]] ^ t[8][p[7]] ^
+		      t[7][p[8]] ^ t[6][p[9]] ^ t[5][p[10]] ^ t[4][p[11]] ^
+		      t[3][p[12]] ^ t[2][p[13]] ^ t[1][p[14]] ^ t[0][p[15]];
+		p += 16;
+	}
+
+	for (; p < tail; ++p) {
+		crc = (crc << 8) ^ t[0][((crc >> 24) ^ p[0]) & 0xff];
+	}
+
+	return crc;
+}
+
+static uint32_t calc_slice16(const uint8_t *head, const uint8_t *tail)
+{
+	return ts_crc32::update_slice16(0xffffffff, head, tail);
+}
+
+const TS_CRC32 ts_crc32::slice16 = {
+	calc_slice16,
+};
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ global function implementation
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+const TS_CRC32 *select_ts_crc32()
+{
+#if defined(TS_CRC32_PCLMUL)
+	uint32_t f = multi2::cpu::features();
+	if ((f & multi2::cpu::FEATURE_PCLMUL) && (f & multi2::cpu::FEATURE_SSSE3)) {
+		return &ts_crc32::pclmul;
+	}
+#endif
+#if defined(TS_CRC32_PMULL)
+	if (multi2::cpu::features() & multi2::cpu::FEATURE_PMULL) {
+		return &ts_crc32::pmull;
+	}
+#endif
+	return &ts_crc32::slice16;
+}
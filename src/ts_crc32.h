@@ -0,0 +1,26 @@
+#ifndef TS_CRC32_H
+#define TS_CRC32_H
+
+#include "portable.h"
+
+typedef struct {
+
+	/* CRC-32/MPEG-2 of [head,tail): polynomial 0x04c11db7, MSB first,
+	   initial value 0xffffffff and no final xor. a whole PSI section
+	   including its CRC_32 field gives 0 */
+	uint32_t (* calc)(const uint8_t *head, const uint8_t *tail);
+
+} TS_CRC32;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* picks the fastest implementation the running CPU supports */
+extern const TS_CRC32 *select_ts_crc32();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TS_CRC32_H */
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ts_crc32.h"
+
+namespace ts_crc32 {
+
+/*
+ * CRC-32/MPEG-2 implementations, one per instruction set, like ts_sync.
+ *
+ * table is the byte at a time loop the section parser always used and
+ * the reference for the others. slice16 looks up 16 bytes per step in
+ * 16 derived tables. pclmul and pmull fold 4 x 16 byte blocks at a time
+ * with carry-less multiplies by x^n mod P and hand the last block and
+ * the tail to update_slice16().
+ */
+enum {
+	POLY = 0x04c11db7,
+};
+
+/* x^n mod P, the folding distances of the carry-less versions */
+enum {
+	X128_MOD_P = 0xe8a45605,
+	X192_MOD_P = 0xc5b9cd4c,
+	X512_MOD_P = 0xe6228b11,
+	X576_MOD_P = 0x8833794c,
+};
+
+/* continues crc over [p,tail) */
+uint32_t update_slice16(uint32_t crc, const uint8_t *p, const uint8_t *tail);
+
+extern const TS_CRC32 table;
+extern const TS_CRC32 slice16;
+#if defined(TS_CRC32_PCLMUL)
+extern const TS_CRC32 pclmul;
+#endif
+#if defined(TS_CRC32_PMULL)
+extern const TS_CRC32 pmull;
+#endif
+
+}
@@ -0,0 +1,65 @@
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#include "ts_crc32_kernel.h"
+
+/* 16 message bytes as one 128 bit polynomial, first byte highest */
+static inline __m128i load_block(const uint8_t *p)
+{
+	const __m128i swap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), swap);
+}
+
+/* x * x^D mod P, still congruent and no wider than 96 bits, with k
+   holding x^D mod P low and x^(D+64) mod P high */
+static inline __m128i fold(__m128i x, __m128i k)
+{
+	return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+static uint32_t calc_pclmul(const uint8_t *head, const uint8_t *tail)
+{
+	if (tail - head < 64) {
+		return ts_crc32::update_slice16(0xffffffff, head, tail);
+	}
+
+	const __m128i k128 = _mm_set_epi64x(static_cast<uint32_t>(ts_crc32::X192_MOD_P), static_cast<uint32_t>(ts_crc32::X128_MOD_P));
+	const __m128i k512 = _mm_set_epi64x(static_cast<uint32_t>(ts_crc32::X576_MOD_P), static_cast<uint32_t>(ts_crc32::X512_MOD_P));
+	const uint8_t *p = head;
+
+	/* the initial register is the same as xor-ing it into the first 4 bytes */
+	__m128i x0 = _mm_xor_si128(load_block(p), _mm_set_epi32(-1, 0, 0, 0));
+	__m128i x1 = load_block(p + 16);
+	__m128i x2 = load_block(p + 32);
+	__m128i x3 = load_block(p + 48);
+	p += 64;
+
+	while (p + 64 <= tail) {
+		x0 = _mm_xor_si128(fold(x0, k512), load_block(p));
+		x1 = _mm_xor_si128(fold(x1, k512), load_block(p + 16));
+		x2 = _mm_xor_si128(fold(x2, k512), load_block(p + 32));
+		x3 = _mm_xor_si128(fold(x3, k512), load_block(p + 48));
+		p += 64;
+	}
+
+	x1 = _mm_xor_si128(fold(x0, k128), x1);
+	x2 = _mm_xor_si128(fold(x1, k128), x2);
+	x3 = _mm_xor_si128(fold(x2, k128), x3);
+
+	while (p + 16 <= tail) {
+		x3 = _mm_xor_si128(fold(x3, k128), load_block(p));
+		p += 16;
+	}
+
+	/* x3 is the message so far mod P, run it through a zero register */
+	uint8_t last[16];
+	const __m128i swap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(last), _mm_shuffle_epi8(x3, swap));
+
+	return ts_crc32::update_slice16(ts_crc32::update_slice16(0, last, last + 16), p, tail);
+}
+
+const TS_CRC32 ts_crc32::pclmul = {
+	calc_pclmul,
+};
@@ -0,0 +1,73 @@
+#include <arm_neon.h>
+
+#include "ts_crc32_kernel.h"
+
+/* 16 message bytes as one 128 bit polynomial, first byte highest: lane 0
+   holds bits 0-63 and lane 1 bits 64-127 */
+static inline uint64x2_t load_block(const uint8_t *p)
+{
+	uint8x16_t v = vrev64q_u8(vld1q_u8(p));
+	return vreinterpretq_u64_u8(vextq_u8(v, v, 8));
+}
+
+static inline void store_block(uint8_t *p, uint64x2_t x)
+{
+	uint8x16_t v = vreinterpretq_u8_u64(x);
+	vst1q_u8(p, vrev64q_u8(vextq_u8(v, v, 8)));
+}
+
+/* x * x^D mod P, still congruent and no wider than 96 bits, with lo
+   = x^D mod P and hi = x^(D+64) mod P */
+static inline uint64x2_t fold(uint64x2_t x, poly64_t lo, poly64_t hi)
+{
+	poly128_t a = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(x, 0)), lo);
+	poly128_t b = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(x, 1)), hi);
+	return veorq_u64(vreinterpretq_u64_p128(a), vreinterpretq_u64_p128(b));
+}
+
+static uint32_t calc_pmull(const uint8_t *head, const uint8_t *tail)
+{
+	if (tail - head < 64) {
+		return ts_crc32::update_slice16(0xffffffff, head, tail);
+	}
+
+	const poly64_t k128 = static_cast<uint32_t>(ts_crc32::X128_MOD_P);
+	const poly64_t k192 = static_cast<uint32_t>(ts_crc32::X192_MOD_P);
+	const poly64_t k512 = static_cast<uint32_t>(ts_crc32::X512_MOD_P);
+	const poly64_t k576 = static_cast<uint32_t>(ts_crc32::X576_MOD_P);
+	const uint8_t *p = head;
+
+	/* the initial register is the same as xor-ing it into the first 4 bytes */
+	uint64x2_t x0 = veorq_u64(load_block(p), vcombine_u64(vcreate_u64(0), vcreate_u64(0xffffffff00000000ull)));
+	uint64x2_t x1 = load_block(p + 16);
+	uint64x2_t x2 = load_block(p + 32);
+	uint64x2_t x3 = load_block(p + 48);
+	p += 64;
+
+	while (p + 64 <= tail) {
+		x0 = veorq_u64(fold(x0, k512, k576), load_block(p));
+		x1 = veorq_u64(fold(x1, k512, k576), load_block(p + 16));
+		x2 = veorq_u64(fold(x2, k512, k576), load_block(p + 32));
+		x3 = veorq_u64(fold(x3, k512, k576), load_block(p + 48));
+		p += 64;
+	}
+
+	x1 = veorq_u64(fold(x0, k128, k192), x1);
+	x2 = veorq_u64(fold(x1, k128, k192), x2);
+	x3 = veorq_u64(fold(x2, k128, k192), x3);
+
+	while (p + 16 <= tail) {
+		x3 = veorq_u64(fold(x3, k128, k192), load_block(p));
+		p += 16;
+	}
+
+	/* x3 is the message so far mod P, run it through a zero register */
+	uint8_t last[16];
+	store_block(last, x3);
+
+	return ts_crc32::update_slice16(ts_crc32::update_slice16(0, last, last + 16), p, tail);
+}
+
+const TS_CRC32 ts_crc32::pmull = {
+	calc_pmull,
+};
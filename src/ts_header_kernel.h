@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ts_header_soa.h"
+
+namespace ts_header {
+
+/*
+ * header extractors, one per instruction set, like ts_sync.
+ *
+ * the 4 header bytes of every packet are gathered into one 32 bit lane
+ * (b0 | b1 << 8 | b2 << 16 | b3 << 24), the fields are cut out of all
+ * lanes with the same shifts and masks and narrowed to the SoA arrays.
+ */
+
+/* internal linkage, like the ts_sync helpers */
+namespace {
+
+/* one packet at a time, for the lanes left over */
+inline void extract_from(const uint8_t *head, int32_t unit, int32_t i, int32_t count, TS_HEADER_SOA *dst) {
+	for (; i < count; ++i) {
+		const uint8_t *p = head + unit * i;
+		dst->pid[i]               = static_cast<uint16_t>(((p[1] & 0x1f) << 8) | p[2]);
+		dst->error[i]             = (p[1] >> 7) & 0x01;
+		dst->unit_start[i]        = (p[1] >> 6) & 0x01;
+		dst->priority[i]          = (p[1] >> 5) & 0x01;
+		dst->scrambling[i]        = (p[3] >> 6) & 0x03;
+		dst->adaptation[i]        = (p[3] >> 4) & 0x03;
+		dst->counter[i]           =  p[3]       & 0x0f;
+		dst->adaptation_length[i] =  p[4];
+	}
+}
+
+}
+
+extern const TS_HEADER_EXTRACTOR generic;
+#if defined(TS_HEADER_AVX2)
+extern const TS_HEADER_EXTRACTOR avx2;
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+extern const TS_HEADER_EXTRACTOR neon;
+#endif
+
+}
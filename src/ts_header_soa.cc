@@ -0,0 +1,96 @@
+#include <cstring>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "ts_header_soa.h"
+#include "ts_header_kernel.h"
+#include "multi2_cpu.h"
+
+static void extract_generic(const uint8_t *head, int32_t unit, int32_t count, TS_HEADER_SOA *dst)
+{
+	ts_header::extract_from(head, unit, 0, count, dst);
+}
+
+const TS_HEADER_EXTRACTOR ts_header::generic = {
+	extract_generic,
+};
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+/* NEON has no gather, the lanes are loaded one by one */
+static inline uint32x4_t gather(const uint8_t *p, int32_t unit)
+{
+	uint32_t v[4];
+	for (int k = 0; k < 4; ++k) {
+		memcpy(&v[k], p + unit * k, sizeof(uint32_t));
+	}
+	return vld1q_u32(v);
+}
+
+/* low byte of every lane */
+static inline void store_u8(uint8_t *dst, uint32x4_t v)
+{
+	uint8_t b[8];
+	vst1_u8(b, vmovn_u16(vcombine_u16(vmovn_u32(v), vdup_n_u16(0))));
+	memcpy(dst, b, 4);
+}
+
+static void extract_neon(const uint8_t *head, int32_t unit, int32_t count, TS_HEADER_SOA *dst)
+{
+	const uint32x4_t bit = vdupq_n_u32(0x01);
+	int32_t i = 0;
+
+	for (; i + 4 <= count; i += 4) {
+		const uint8_t *p = head + unit * i;
+		uint32x4_t h = gather(p, unit);
+		uint32x4_t a = gather(p + 4, unit);
+		uint32x4_t pid = vorrq_u32(vandq_u32(h, vdupq_n_u32(0x1f00)), vandq_u32(vshrq_n_u32(h, 16), vdupq_n_u32(0xff)));
+		vst1_u16(dst->pid + i, vmovn_u32(pid));
+		store_u8(dst->error + i,             vandq_u32(vshrq_n_u32(h, 15), bit));
+		store_u8(dst->unit_start + i,        vandq_u32(vshrq_n_u32(h, 14), bit));
+		store_u8(dst->priority + i,          vandq_u32(vshrq_n_u32(h, 13), bit));
+		store_u8(dst->scrambling + i,        vshrq_n_u32(h, 30));
+		store_u8(dst->adaptation + i,        vandq_u32(vshrq_n_u32(h, 28), vdupq_n_u32(0x03)));
+		store_u8(dst->counter + i,           vandq_u32(vshrq_n_u32(h, 24), vdupq_n_u32(0x0f)));
+		store_u8(dst->adaptation_length + i, a);
+	}
+
+	ts_header::extract_from(head, unit, i, count, dst);
+}
+
+const TS_HEADER_EXTRACTOR ts_header::neon = {
+	extract_neon,
+};
+
+#endif
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ global function implementation
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+const TS_HEADER_EXTRACTOR *select_ts_header_extractor()
+{
+#if defined(TS_HEADER_AVX2)
+	if (multi2::cpu::features() & multi2::cpu::FEATURE_AVX2) {
+		return &ts_header::avx2;
+	}
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+	return &ts_header::neon;
+#else
+	return &ts_header::generic;
+#endif
+}
+
+void get_ts_header_soa(const TS_HEADER_SOA *src, int32_t i, TS_HEADER *dst)
+{
+	dst->sync                         = 0x47;
+	dst->transport_error_indicator    = src->error[i];
+	dst->payload_unit_start_indicator = src->unit_start[i];
+	dst->transport_priority           = src->priority[i];
+	dst->pid                          = src->pid[i];
+	dst->transport_scrambling_control = src->scrambling[i];
+	dst->adaptation_field_control     = src->adaptation[i];
+	dst->continuity_counter           = src->counter[i];
+}
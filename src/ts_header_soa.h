@@ -0,0 +1,46 @@
+#ifndef TS_HEADER_SOA_H
+#define TS_HEADER_SOA_H
+
+#include "portable.h"
+#include "ts_common_types.h"
+
+/* packets whose headers are unpacked at once */
+#define TS_HEADER_SOA_MAX 16
+
+/* the TS_HEADER fields of up to TS_HEADER_SOA_MAX packets, one narrow
+   array per field */
+typedef struct {
+	uint16_t          pid[TS_HEADER_SOA_MAX];
+	uint8_t           error[TS_HEADER_SOA_MAX];       /* transport_error_indicator    */
+	uint8_t           unit_start[TS_HEADER_SOA_MAX];  /* payload_unit_start_indicator */
+	uint8_t           priority[TS_HEADER_SOA_MAX];    /* transport_priority           */
+	uint8_t           scrambling[TS_HEADER_SOA_MAX];  /* transport_scrambling_control */
+	uint8_t           adaptation[TS_HEADER_SOA_MAX];  /* adaptation_field_control     */
+	uint8_t           counter[TS_HEADER_SOA_MAX];     /* continuity_counter           */
+	uint8_t           adaptation_length[TS_HEADER_SOA_MAX]; /* byte 4, valid only with an adaptation field */
+} TS_HEADER_SOA;
+
+typedef struct {
+
+	/* unpacks the headers of the count (<= TS_HEADER_SOA_MAX) packets at
+	   head, head+unit, head+unit*2... the first 5 bytes of each must be
+	   readable */
+	void (* extract)(const uint8_t *head, int32_t unit, int32_t count, TS_HEADER_SOA *dst);
+
+} TS_HEADER_EXTRACTOR;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* picks the widest extractor the running CPU supports */
+extern const TS_HEADER_EXTRACTOR *select_ts_header_extractor();
+
+/* the i-th entry as a TS_HEADER, for the section parsers */
+extern void get_ts_header_soa(const TS_HEADER_SOA *src, int32_t i, TS_HEADER *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TS_HEADER_SOA_H */
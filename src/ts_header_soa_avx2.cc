@@ -0,0 +1,58 @@
+#include <immintrin.h>
+
+#include "ts_header_kernel.h"
+
+/* bytes 0-7 of 32 are the 8 packets of one field */
+static inline void store_u8(uint8_t *dst, __m128i v)
+{
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(dst), v);
+}
+
+static void extract_avx2(const uint8_t *head, int32_t unit, int32_t count, TS_HEADER_SOA *dst)
+{
+	const __m256i step = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(unit));
+	const __m256i bit = _mm256_set1_epi32(0x01);
+	/* undoes the per 128 bit lane interleave of the packs below */
+	const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	int32_t i = 0;
+
+	for (; i + 8 <= count; i += 8) {
+		const uint8_t *p = head + unit * i;
+		__m256i h = _mm256_i32gather_epi32(reinterpret_cast<const int *>(p), step, 1);
+		__m256i a = _mm256_i32gather_epi32(reinterpret_cast<const int *>(p + 4), step, 1);
+
+		__m256i pid = _mm256_or_si256(_mm256_and_si256(h, _mm256_set1_epi32(0x1f00)),
+		                              _mm256_and_si256(_mm256_srli_epi32(h, 16), _mm256_set1_epi32(0xff)));
+		pid = _mm256_permute4x64_epi64(_mm256_packus_epi32(pid, pid), 0x08);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst->pid + i), _mm256_castsi256_si128(pid));
+
+		/* 4 fields per register: 32 -> 16 -> 8 bits, then one dword of 4
+		   packets per field and lane, put in packet order by order */
+		__m256i f0 = _mm256_packus_epi16(
+			_mm256_packus_epi32(_mm256_and_si256(_mm256_srli_epi32(h, 15), bit),
+			                    _mm256_and_si256(_mm256_srli_epi32(h, 14), bit)),
+			_mm256_packus_epi32(_mm256_and_si256(_mm256_srli_epi32(h, 13), bit),
+			                    _mm256_srli_epi32(h, 30)));
+		__m256i f1 = _mm256_packus_epi16(
+			_mm256_packus_epi32(_mm256_and_si256(_mm256_srli_epi32(h, 28), _mm256_set1_epi32(0x03)),
+			                    _mm256_and_si256(_mm256_srli_epi32(h, 24), _mm256_set1_epi32(0x0f))),
+			_mm256_packus_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0xff)),
+			                    _mm256_setzero_si256()));
+		f0 = _mm256_permutevar8x32_epi32(f0, order);
+		f1 = _mm256_permutevar8x32_epi32(f1, order);
+
+		store_u8(dst->error + i,             _mm256_castsi256_si128(f0));
+		store_u8(dst->unit_start + i,        _mm_unpackhi_epi64(_mm256_castsi256_si128(f0), _mm256_castsi256_si128(f0)));
+		store_u8(dst->priority + i,          _mm256_extracti128_si256(f0, 1));
+		store_u8(dst->scrambling + i,        _mm_unpackhi_epi64(_mm256_extracti128_si256(f0, 1), _mm256_extracti128_si256(f0, 1)));
+		store_u8(dst->adaptation + i,        _mm256_castsi256_si128(f1));
+		store_u8(dst->counter + i,           _mm_unpackhi_epi64(_mm256_castsi256_si128(f1), _mm256_castsi256_si128(f1)));
+		store_u8(dst->adaptation_length + i, _mm256_extracti128_si256(f1, 1));
+	}
+
+	ts_header::extract_from(head, unit, i, count, dst);
+}
+
+const TS_HEADER_EXTRACTOR ts_header::avx2 = {
+	extract_avx2,
+};
@@ -3,6 +3,7 @@
 
 #include "ts_section_parser.h"
 #include "ts_section_parser_error_code.h"
+#include "ts_crc32.h"
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  inner structures
@@ -20,6 +21,17 @@ typedef struct {
 	int32_t                 count;
 } TS_SECTION_LIST;
 
+typedef struct {
+	void                   *next;
+	int32_t                 count;
+} TS_SECTION_BLOCK;
+
+typedef struct {
+	TS_SECTION_ELEM        *free;  /* linked through next */
+	TS_SECTION_BLOCK       *block;
+	int32_t                 grow;  /* elements in the next block */
+} TS_SECTION_SLAB_PRIVATE_DATA;
+
 typedef struct {
 
 	int32_t                 pid;
@@ -31,6 +43,13 @@ typedef struct {
 	TS_SECTION_LIST         buff;
 
 	TS_SECTION_PARSER_STAT  stat;
+
+	const TS_CRC32         *crc;
+
+	TS_SECTION_SLAB_PRIVATE_DATA *slab;
+
+	TS_SECTION_CALLBACK     callback;
+	void                   *callback_ctx;
 	
 } TS_SECTION_PARSER_PRIVATE_DATA;
 
@@ -39,6 +58,12 @@ typedef struct {
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 #define MAX_RAW_SECTION_SIZE 4100
 
+/* element plus raw buffer, rounded up to keep the next one aligned */
+#define SLAB_ELEM_SIZE ((sizeof(TS_SECTION_ELEM) + MAX_RAW_SECTION_SIZE + 15) & ~((size_t)15))
+
+#define SLAB_GROW_MIN 4
+#define SLAB_GROW_MAX 64
+
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  function prottypes (interface method)
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
@@ -49,11 +74,19 @@ static int get_ts_section_parser(void *parser, TS_SECTION *sect);
 static int ret_ts_section_parser(void *parser, TS_SECTION *sect);
 static int get_count_ts_section_parser(void *parser);
 static int get_stat_ts_section_parser(void *parser, TS_SECTION_PARSER_STAT *stat);
+static int set_callback_ts_section_parser(void *parser, TS_SECTION_CALLBACK callback, void *ctx);
+
+static void release_ts_section_slab(void *slab);
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  global function implementation (factory method)
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser()
+{
+	return create_ts_section_parser_with_slab(NULL);
+}
+
+ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser_with_slab(TS_SECTION_SLAB *slab)
 {
 	TS_SECTION_PARSER *r;
 	TS_SECTION_PARSER_PRIVATE_DATA *prv;
@@ -70,6 +103,10 @@ ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser()
 	}
 
 	prv->pid = -1;
+	prv->crc = select_ts_crc32();
+	if(slab != NULL){
+		prv->slab = (TS_SECTION_SLAB_PRIVATE_DATA *)(slab->private_data);
+	}
 
 	r = (TS_SECTION_PARSER *)(prv+1);
 	r->private_data = prv;
@@ -85,6 +122,34 @@ ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser()
 
 	r->get_stat = get_stat_ts_section_parser;
 
+	r->set_callback = set_callback_ts_section_parser;
+
+	return r;
+}
+
+ARIB25_API_EXPORT TS_SECTION_SLAB *create_ts_section_slab()
+{
+	TS_SECTION_SLAB *r;
+	TS_SECTION_SLAB_PRIVATE_DATA *prv;
+
+	int n;
+
+	n  = sizeof(TS_SECTION_SLAB_PRIVATE_DATA);
+	n += sizeof(TS_SECTION_SLAB);
+
+	prv = (TS_SECTION_SLAB_PRIVATE_DATA *)calloc(1, n);
+	if(prv == NULL){
+		/* failed on malloc() - no enough memory */
+		return NULL;
+	}
+
+	prv->grow = SLAB_GROW_MIN;
+
+	r = (TS_SECTION_SLAB *)(prv+1);
+	r->private_data = prv;
+
+	r->release = release_ts_section_slab;
+
 	return r;
 }
 
@@ -101,24 +166,26 @@ static void reset_section(TS_SECTION *sect);
 static void append_section_data(TS_SECTION *sect, uint8_t *data, int size);
 static int check_section_complete(TS_SECTION *sect);
 
-static int compare_elem_section(TS_SECTION_ELEM *a, TS_SECTION_ELEM *b);
+static int compare_elem_section(TS_SECTION_ELEM *a, TS_SECTION *b);
+static int settle_elem_complete(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
+static int settle_packet_section(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION *sect);
 
 static void cancel_elem_empty(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
 static void cancel_elem_error(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
 static void cancel_elem_same(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
-static void commit_elem_updated(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
+static int commit_elem_updated(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem, TS_SECTION *sect);
 
 static TS_SECTION_ELEM *query_work_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv);
 
 static void extract_ts_section_header(TS_SECTION *sect);
 
-static TS_SECTION_ELEM *create_ts_section_elem();
+static TS_SECTION_ELEM *create_ts_section_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv);
+static void release_ts_section_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem);
+static TS_SECTION_ELEM *alloc_slab_elem(TS_SECTION_SLAB_PRIVATE_DATA *slab);
 static TS_SECTION_ELEM *get_ts_section_list_head(TS_SECTION_LIST *list);
 static void put_ts_section_list_tail(TS_SECTION_LIST *list, TS_SECTION_ELEM *elem);
 static void unlink_ts_section_list(TS_SECTION_LIST *list, TS_SECTION_ELEM *elem);
-static void clear_ts_section_list(TS_SECTION_LIST *list);
-
-static uint32_t crc32(uint8_t *head, uint8_t *tail);
+static void clear_ts_section_list(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_LIST *list);
 
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  function implementation (interface method)
@@ -249,6 +316,47 @@ static int get_stat_ts_section_parser(void *parser, TS_SECTION_PARSER_STAT *stat
 	return 0;
 }
 
+static int set_callback_ts_section_parser(void *parser, TS_SECTION_CALLBACK callback, void *ctx)
+{
+	TS_SECTION_PARSER_PRIVATE_DATA *prv;
+
+	prv = private_data(parser);
+	if(prv == NULL){
+		return TS_SECTION_PARSER_ERROR_INVALID_PARAM;
+	}
+
+	prv->callback = callback;
+	prv->callback_ctx = ctx;
+
+	return 0;
+}
+
+static void release_ts_section_slab(void *slab)
+{
+	TS_SECTION_SLAB_PRIVATE_DATA *prv;
+	TS_SECTION_BLOCK *b;
+	TS_SECTION_BLOCK *n;
+
+	if(slab == NULL){
+		return;
+	}
+
+	prv = (TS_SECTION_SLAB_PRIVATE_DATA *)(((TS_SECTION_SLAB *)slab)->private_data);
+	if( (prv == NULL) || (((void *)(prv+1)) != slab) ){
+		return;
+	}
+
+	b = prv->block;
+	while(b != NULL){
+		n = (TS_SECTION_BLOCK *)(b->next);
+		free(b);
+		b = n;
+	}
+
+	memset(slab, 0, sizeof(TS_SECTION_SLAB));
+	free(prv);
+}
+
 /*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  function implementation (private method)
  ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
@@ -275,14 +383,14 @@ static void teardown(TS_SECTION_PARSER_PRIVATE_DATA *prv)
 	prv->pid = -1;
 
 	if(prv->work != NULL){
-		free(prv->work);
+		release_ts_section_elem(prv, prv->work);
 		prv->work = NULL;
 	}
 
 	prv->last = NULL;
 	
-	clear_ts_section_list(&(prv->pool));
-	clear_ts_section_list(&(prv->buff));
+	clear_ts_section_list(prv, &(prv->pool));
+	clear_ts_section_list(prv, &(prv->buff));
 
 	memset(&(prv->stat), 0, sizeof(TS_SECTION_PARSER_STAT));
 }
@@ -305,20 +413,7 @@ static int put_exclude_section_start(TS_SECTION_PARSER_PRIVATE_DATA *prv, uint8_
 
 	prv->work = NULL;
 
-	if( (w->sect.hdr.section_syntax_indicator != 0) &&
-	    (crc32(w->sect.raw, w->sect.tail) != 0) ){
-		cancel_elem_error(prv, w);
-		return TS_SECTION_PARSER_WARN_CRC_MISSMATCH;
-	}
-
-	if(compare_elem_section(w, prv->last) == 0){
-		/* same section data */
-		cancel_elem_same(prv, w);
-		return 0;
-	}
-
-	commit_elem_updated(prv, w);
-	return 0;
+	return settle_elem_complete(prv, w);
 }
 
 static int put_include_section_start(TS_SECTION_PARSER_PRIVATE_DATA *prv, uint8_t *data, int size)
@@ -330,8 +425,9 @@ static int put_include_section_start(TS_SECTION_PARSER_PRIVATE_DATA *prv, uint8_
 	uint8_t *p;
 	uint8_t *tail;
 
-	int r;
-	int length;
+	int r,n;
+
+	TS_SECTION sect;
 
 	p = data;
 	tail = p + size;
@@ -377,31 +473,34 @@ static int put_include_section_start(TS_SECTION_PARSER_PRIVATE_DATA *prv, uint8_
 	}
 
 	do {
-		
-		w = query_work_elem(prv);
-		if(w == NULL){
-			return TS_SECTION_PARSER_ERROR_NO_ENOUGH_MEMORY;
-		}
-		
-		append_section_data(&(w->sect), p, tail-p);
-		if(check_section_complete(&(w->sect)) == 0){
+
+		/* a section that ends inside this payload is checked where it
+		   is, only one that goes on into the next packets is copied */
+		memset(&(sect.hdr), 0, sizeof(TS_SECTION_HEADER));
+		sect.raw = p;
+		sect.tail = tail;
+		extract_ts_section_header(&sect);
+		if(check_section_complete(&sect) == 0){
+			w = query_work_elem(prv);
+			if(w == NULL){
+				return TS_SECTION_PARSER_ERROR_NO_ENOUGH_MEMORY;
+			}
+			append_section_data(&(w->sect), p, tail-p);
 			/* need more data */
 			prv->work = w;
 			return 0;
 		}
-		length = (w->sect.tail - w->sect.raw);
+		sect.tail = sect.raw + (sect.hdr.section_length + 3);
 
-		if( (w->sect.hdr.section_syntax_indicator != 0) &&
-		    (crc32(w->sect.raw, w->sect.tail) != 0) ){
-			cancel_elem_error(prv, w);
-			r = TS_SECTION_PARSER_WARN_CRC_MISSMATCH;
-		}else if(compare_elem_section(w, prv->last) == 0){
-			cancel_elem_same(prv, w);
-		}else{
-			commit_elem_updated(prv, w);
+		n = settle_packet_section(prv, &sect);
+		if(n < 0){
+			return n;
+		}
+		if(n > 0){
+			r = n;
 		}
 
-		p += length;
+		p = sect.tail;
 		
 	} while ( (p < tail) && (p[0] != 0xff) );
 
@@ -464,7 +563,7 @@ static int check_section_complete(TS_SECTION *sect)
 	return 1;
 }
 
-static int compare_elem_section(TS_SECTION_ELEM *a, TS_SECTION_ELEM *b)
+static int compare_elem_section(TS_SECTION_ELEM *a, TS_SECTION *b)
 {
 	int m,n;
 	
@@ -473,18 +572,72 @@ static int compare_elem_section(TS_SECTION_ELEM *a, TS_SECTION_ELEM *b)
 	}
 
 	m = a->sect.tail - a->sect.raw;
-	n = b->sect.tail - b->sect.raw;
+	n = b->tail - b->raw;
 	if( m != n ){
 		return 1;
 	}
 
-	if(memcmp(a->sect.raw, b->sect.raw, m) != 0){
+	if(memcmp(a->sect.raw, b->raw, m) != 0){
 		return 1;
 	}
 
 	return 0;
 }
 
+static int settle_elem_complete(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem)
+{
+	/* most sections are byte identical repeats of the last one, which
+	   already passed the crc check - a memcmp() settles them */
+	if(compare_elem_section(prv->last, &(elem->sect)) == 0){
+		cancel_elem_same(prv, elem);
+		return 0;
+	}
+
+	if( (elem->sect.hdr.section_syntax_indicator != 0) &&
+	    (prv->crc->calc(elem->sect.raw, elem->sect.tail) != 0) ){
+		cancel_elem_error(prv, elem);
+		return TS_SECTION_PARSER_WARN_CRC_MISSMATCH;
+	}
+
+	return commit_elem_updated(prv, elem, &(elem->sect));
+}
+
+/* sect points into the packet payload given to put(). repeats and crc
+   errors are settled without copying it, a new section is copied once
+   to become last (and to be queued when there is no callback) */
+static int settle_packet_section(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION *sect)
+{
+	TS_SECTION_ELEM *w;
+	int n;
+	
+	if(compare_elem_section(prv->last, sect) == 0){
+		prv->stat.total += 1;
+		prv->stat.repeat += 1;
+		return 0;
+	}
+
+	if( (sect->hdr.section_syntax_indicator != 0) &&
+	    (prv->crc->calc(sect->raw, sect->tail) != 0) ){
+		prv->stat.total += 1;
+		prv->stat.error += 1;
+		return TS_SECTION_PARSER_WARN_CRC_MISSMATCH;
+	}
+
+	w = query_work_elem(prv);
+	if(w == NULL){
+		return TS_SECTION_PARSER_ERROR_NO_ENOUGH_MEMORY;
+	}
+
+	n = sect->tail - sect->raw;
+	memcpy(w->sect.raw, sect->raw, n);
+	memcpy(&(w->sect.hdr), &(sect->hdr), sizeof(TS_SECTION_HEADER));
+	w->sect.data = w->sect.raw + (sect->data - sect->raw);
+	w->sect.tail = w->sect.raw + n;
+
+	/* the callback still gets the borrowed one */
+	return commit_elem_updated(prv, w, sect);
+}
+
 static void cancel_elem_empty(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem)
 {
 	reset_section(&(elem->sect));
@@ -507,19 +660,30 @@ static void cancel_elem_same(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELE
 	elem->ref = 0;
 	put_ts_section_list_tail(&(prv->pool), elem);
 	prv->stat.total +=1;
+	prv->stat.repeat += 1;
 }
 
-static void commit_elem_updated(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem)
+static int commit_elem_updated(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem, TS_SECTION *sect)
 {
 	if( (prv->last != NULL) && (prv->last->ref > 0) ){
 		prv->last->ref -= 1;
 	}
 
-	elem->ref = 2;
 	prv->last = elem;
-	put_ts_section_list_tail(&(prv->buff), elem);
 	prv->stat.total += 1;
 	prv->stat.unique += 1;
+
+	if(prv->callback != NULL){
+		/* only kept as last for the repeat check, the callback borrows it */
+		elem->ref = 1;
+		put_ts_section_list_tail(&(prv->pool), elem);
+		return prv->callback(prv->callback_ctx, sect);
+	}
+
+	elem->ref = 2;
+	put_ts_section_list_tail(&(prv->buff), elem);
+
+	return 0;
 }
 
 static TS_SECTION_ELEM *query_work_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv)
@@ -541,7 +705,7 @@ static TS_SECTION_ELEM *query_work_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv)
 		return r;
 	}
 
-	return create_ts_section_elem();
+	return create_ts_section_elem(prv);
 }
 
 static void extract_ts_section_header(TS_SECTION *sect)
@@ -588,11 +752,15 @@ static void extract_ts_section_header(TS_SECTION *sect)
 	return;
 }
 
-static TS_SECTION_ELEM *create_ts_section_elem()
+static TS_SECTION_ELEM *create_ts_section_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv)
 {
 	TS_SECTION_ELEM *r;
 	int n;
 
+	if(prv->slab != NULL){
+		return alloc_slab_elem(prv->slab);
+	}
+
 	n = sizeof(TS_SECTION_ELEM) + MAX_RAW_SECTION_SIZE;
 	r = (TS_SECTION_ELEM *)calloc(1, n);
 	if(r == NULL){
@@ -606,6 +774,60 @@ static TS_SECTION_ELEM *create_ts_section_elem()
 	return r;
 }
 
+static void release_ts_section_elem(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_ELEM *elem)
+{
+	if(prv->slab == NULL){
+		free(elem);
+		return;
+	}
+
+	elem->prev = NULL;
+	elem->next = prv->slab->free;
+	prv->slab->free = elem;
+}
+
+static TS_SECTION_ELEM *alloc_slab_elem(TS_SECTION_SLAB_PRIVATE_DATA *slab)
+{
+	TS_SECTION_BLOCK *b;
+	TS_SECTION_ELEM *r;
+	uint8_t *p;
+
+	int i;
+
+	if(slab->free == NULL){
+		/* every block is in use - the next one is twice as large, up to
+		   SLAB_GROW_MAX elements, so busy streams settle on few blocks */
+		b = (TS_SECTION_BLOCK *)malloc(sizeof(TS_SECTION_BLOCK) + SLAB_ELEM_SIZE*slab->grow);
+		if(b == NULL){
+			/* failed on malloc() */
+			return NULL;
+		}
+		b->count = slab->grow;
+		b->next = slab->block;
+		slab->block = b;
+
+		p = (uint8_t *)(b+1);
+		for(i=0;i<b->count;i++){
+			r = (TS_SECTION_ELEM *)(p + SLAB_ELEM_SIZE*i);
+			r->next = slab->free;
+			slab->free = r;
+		}
+
+		if(slab->grow < SLAB_GROW_MAX){
+			slab->grow *= 2;
+		}
+	}
+
+	r = slab->free;
+	slab->free = (TS_SECTION_ELEM *)(r->next);
+
+	memset(r, 0, sizeof(TS_SECTION_ELEM));
+	r->sect.raw = (uint8_t *)(r+1);
+	r->sect.tail = r->sect.raw;
+
+	return r;
+}
+
 static TS_SECTION_ELEM *get_ts_section_list_head(TS_SECTION_LIST *list)
 {
 	TS_SECTION_ELEM *r;
@@ -681,7 +903,7 @@ static void unlink_ts_section_list(TS_SECTION_LIST *list, TS_SECTION_ELEM *elem)
 	list->count -= 1;
 }
 
-static void clear_ts_section_list(TS_SECTION_LIST *list)
+static void clear_ts_section_list(TS_SECTION_PARSER_PRIVATE_DATA *prv, TS_SECTION_LIST *list)
 {
 	TS_SECTION_ELEM *e;
 	TS_SECTION_ELEM *n;
@@ -693,7 +915,7 @@ static void clear_ts_section_list(TS_SECTION_LIST *list)
 	e = list->head;
 	while(e != NULL){
 		n = (TS_SECTION_ELEM *)(e->next);
-		free(e);
+		release_ts_section_elem(prv, e);
 		e = n;
 	}
 	
@@ -702,101 +924,3 @@ static void clear_ts_section_list(TS_SECTION_LIST *list)
 	list->count = 0;
 }
 
-static uint32_t crc32(uint8_t *head, uint8_t *tail)
-{
-	uint32_t crc;
-	uint8_t *p;
-
-	static const uint32_t table[256] = {
-		0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
-		0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
-		0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 
-		0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
-		
-		0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9,
-		0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75, 
-		0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011,
-		0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
-		
-		0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039,
-		0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
-		0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 
-		0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
-		
-		0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49,
-		0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
-		0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 
-		0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
-
-		0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE,
-		0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072, 
-		0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16,
-		0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
-
-		0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 
-		0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
-		0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066,
-		0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
-		
-		0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E,
-		0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
-		0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 
-		0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
-
-		0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E,
-		0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2, 
-		0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686,
-		0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
-
-		0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 
-		0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
-		0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F,
-		0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53, 
-		
-		0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47,
-		0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
-		0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF,
-		0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
-
-		0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7,
-		0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B, 
-		0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F,
-		0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
-		
-		0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 
-		0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
-		0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F,
-		0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3, 
-		
-		0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640,
-		0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
-		0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8,
-		0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
-
-		0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30,
-		0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
-		0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088,
-		0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
-
-		0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0,
-		0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
-		0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18,
-		0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4, 
-
-		0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0,
-		0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
-		0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 
-		0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
-	};
-	
-	crc = 0xffffffff;
-
-	p = head;
-	while(p < tail){
-		crc = (crc << 8) ^ table[ ((crc >> 24) ^ p[0]) & 0xff ];
-		p += 1;
-	}
-
-	return crc;
-}
-
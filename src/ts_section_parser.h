@@ -8,8 +8,14 @@ typedef struct {
 	int64_t total;      /* total received section count      */
 	int64_t unique;     /* unique section count              */
 	int64_t error;      /* crc and other error section count */
+	int64_t repeat;     /* repeats of the last unique section, dropped before the crc check */
 } TS_SECTION_PARSER_STAT;
 
+/* gets every new section that passed the checks, instead of it being
+   queued for get(). sect is only borrowed for the call and must not be
+   passed to ret(). a negative return aborts put(), which returns it */
+typedef int (* TS_SECTION_CALLBACK)(void *ctx, TS_SECTION *sect);
+
 typedef struct {
 
 	void *private_data;
@@ -25,14 +31,28 @@ typedef struct {
 	int (* get_count)(void *parser);
 	
 	int (* get_stat)(void *parser, TS_SECTION_PARSER_STAT *stat);
+
+	int (* set_callback)(void *parser, TS_SECTION_CALLBACK callback, void *ctx);
 	
 } TS_SECTION_PARSER;
 
+/* section buffers shared by the parsers created with it, which must all
+   be released before the slab itself */
+typedef struct {
+
+	void *private_data;
+
+	void (* release)(void *slab);
+
+} TS_SECTION_SLAB;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 extern ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser();
+extern ARIB25_API_EXPORT TS_SECTION_PARSER *create_ts_section_parser_with_slab(TS_SECTION_SLAB *slab);
+extern ARIB25_API_EXPORT TS_SECTION_SLAB *create_ts_section_slab();
 
 #ifdef __cplusplus
 }
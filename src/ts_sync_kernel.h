@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ts_sync_scanner.h"
+
+namespace ts_sync {
+
+/*
+ * sync byte scanners, one per instruction set, like multi2::kernel.
+ *
+ * a vector of positions is tested at once by AND-ing the compares of
+ * the bytes 0, unit, 2*unit... ahead, so each lane answers whether a
+ * whole chain starts there. chains longer than PROBE are narrowed down
+ * by the vector test and finished by verify().
+ */
+enum {
+	SYNC_BYTE = 0x47,
+	PROBE     = 8,
+};
+
+static const int32_t pair_unit[3] = { 188, 192, 204 };
+
+/* the helpers below are also compiled into the -mavx2 unit, internal
+   linkage keeps the linker from handing that copy to the generic one */
+namespace {
+
+/* v must not be 0 */
+inline int lowest_bit(uint64_t v) {
+#if defined(__GNUC__)
+	return __builtin_ctzll(v);
+#else
+	int n = 0;
+	while (!(v & 1)) {
+		v >>= 1;
+		n += 1;
+	}
+	return n;
+#endif
+}
+
+/* the rest of a chain whose first probes already matched */
+inline bool verify(const uint8_t *p, int32_t unit, int32_t count) {
+	for (int32_t i = PROBE; i < count; ++i) {
+		if (p[unit * i] != SYNC_BYTE) {
+			return false;
+		}
+	}
+	return true;
+}
+
+inline bool match(const uint8_t *p, int32_t unit, int32_t count) {
+	for (int32_t i = 0; i < count; ++i) {
+		if (p[unit * i] != SYNC_BYTE) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* adds the pairs starting at p or later to count, one byte at a time */
+inline void count_pairs_from(const uint8_t *p, const uint8_t *tail, int32_t *count) {
+	for (; p + pair_unit[0] < tail; ++p) {
+		if (p[0] != SYNC_BYTE) {
+			continue;
+		}
+		for (int k = 0; k < 3; ++k) {
+			if (p + pair_unit[k] < tail && p[pair_unit[k]] == SYNC_BYTE) {
+				count[k] += 1;
+			}
+		}
+	}
+}
+
+}
+
+extern const TS_SYNC_SCANNER generic;
+#if defined(TS_SYNC_AVX2)
+extern const TS_SYNC_SCANNER avx2;
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+extern const TS_SYNC_SCANNER neon;
+#endif
+
+}
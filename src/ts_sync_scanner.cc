@@ -0,0 +1,133 @@
+#include <cstring>
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "ts_sync_scanner.h"
+#include "ts_sync_kernel.h"
+#include "multi2_cpu.h"
+
+static uint8_t *find_generic(uint8_t *head, uint8_t *last, int32_t unit, int32_t count)
+{
+	uint8_t *p = head;
+
+	while (p <= last) {
+		p = static_cast<uint8_t *>(memchr(p, ts_sync::SYNC_BYTE, (last - p) + 1));
+		if (p == NULL) {
+			return NULL;
+		}
+		if (ts_sync::match(p, unit, count)) {
+			return p;
+		}
+		p += 1;
+	}
+
+	return NULL;
+}
+
+static void count_pairs_generic(const uint8_t *head, const uint8_t *tail, int32_t *count)
+{
+	count[0] = count[1] = count[2] = 0;
+	ts_sync::count_pairs_from(head, tail, count);
+}
+
+const TS_SYNC_SCANNER ts_sync::generic = {
+	find_generic,
+	count_pairs_generic,
+};
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+/* 4 bits per lane, NEON has no movemask */
+static inline uint64_t lane_mask(uint8x16_t m)
+{
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+static inline int32_t lane_sum(uint8x16_t c)
+{
+	uint64x2_t v = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(c)));
+	return static_cast<int32_t>(vgetq_lane_u64(v, 0) + vgetq_lane_u64(v, 1));
+}
+
+static uint8_t *find_neon(uint8_t *head, uint8_t *last, int32_t unit, int32_t count)
+{
+	const uint8x16_t s = vdupq_n_u8(ts_sync::SYNC_BYTE);
+	int32_t probe = (count < ts_sync::PROBE) ? count : static_cast<int32_t>(ts_sync::PROBE);
+	uint8_t *p = head;
+
+	while (p + 16 <= last + 1) {
+		uint8x16_t m = vceqq_u8(vld1q_u8(p), s);
+		uint64_t bits = lane_mask(m);
+		if (bits != 0) {
+			for (int32_t i = 1; i < probe; ++i) {
+				m = vandq_u8(m, vceqq_u8(vld1q_u8(p + unit * i), s));
+			}
+			bits = lane_mask(m);
+			while (bits != 0) {
+				uint8_t *q = p + ts_sync::lowest_bit(bits) / 4;
+				if (ts_sync::verify(q, unit, count)) {
+					return q;
+				}
+				bits &= ~(static_cast<uint64_t>(0xf) << ((q - p) * 4));
+			}
+		}
+		p += 16;
+	}
+
+	return find_generic(p, last, unit, count);
+}
+
+static void count_pairs_neon(const uint8_t *head, const uint8_t *tail, int32_t *count)
+{
+	const uint8x16_t s = vdupq_n_u8(ts_sync::SYNC_BYTE);
+	const uint8x16_t one = vdupq_n_u8(1);
+	const uint8_t *p = head;
+
+	count[0] = count[1] = count[2] = 0;
+
+	/* every lane has all three partners inside [head,tail) */
+	while (p + 16 + ts_sync::pair_unit[2] <= tail) {
+		/* byte counters, folded before they can wrap */
+		uint8x16_t c0 = vdupq_n_u8(0);
+		uint8x16_t c1 = vdupq_n_u8(0);
+		uint8x16_t c2 = vdupq_n_u8(0);
+		for (int i = 0; (i < 255) && (p + 16 + ts_sync::pair_unit[2] <= tail); ++i) {
+			uint8x16_t m = vandq_u8(vceqq_u8(vld1q_u8(p), s), one);
+			c0 = vaddq_u8(c0, vandq_u8(m, vceqq_u8(vld1q_u8(p + ts_sync::pair_unit[0]), s)));
+			c1 = vaddq_u8(c1, vandq_u8(m, vceqq_u8(vld1q_u8(p + ts_sync::pair_unit[1]), s)));
+			c2 = vaddq_u8(c2, vandq_u8(m, vceqq_u8(vld1q_u8(p + ts_sync::pair_unit[2]), s)));
+			p += 16;
+		}
+		count[0] += lane_sum(c0);
+		count[1] += lane_sum(c1);
+		count[2] += lane_sum(c2);
+	}
+
+	ts_sync::count_pairs_from(p, tail, count);
+}
+
+const TS_SYNC_SCANNER ts_sync::neon = {
+	find_neon,
+	count_pairs_neon,
+};
+
+#endif
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ global function implementation
+ ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+const TS_SYNC_SCANNER *select_ts_sync_scanner()
+{
+#if defined(TS_SYNC_AVX2)
+	if (multi2::cpu::features() & multi2::cpu::FEATURE_AVX2) {
+		return &ts_sync::avx2;
+	}
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+	return &ts_sync::neon;
+#else
+	return &ts_sync::generic;
+#endif
+}
@@ -0,0 +1,30 @@
+#ifndef TS_SYNC_SCANNER_H
+#define TS_SYNC_SCANNER_H
+
+#include "portable.h"
+
+typedef struct {
+
+	/* returns the first p in [head,last] where count sync bytes follow
+	   each other unit bytes apart, or NULL. p+unit*(count-1) must be
+	   readable for every p up to last */
+	uint8_t *(* find)(uint8_t *head, uint8_t *last, int32_t unit, int32_t count);
+
+	/* count[0..2] = number of p with p[0] == p[u] == 0x47 and p+u < tail,
+	   for u = 188, 192 and 204 */
+	void (* count_pairs)(const uint8_t *head, const uint8_t *tail, int32_t *count);
+
+} TS_SYNC_SCANNER;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* picks the widest scanner the running CPU supports */
+extern const TS_SYNC_SCANNER *select_ts_sync_scanner();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TS_SYNC_SCANNER_H */
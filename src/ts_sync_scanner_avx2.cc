@@ -0,0 +1,79 @@
+#include <immintrin.h>
+
+#include "ts_sync_kernel.h"
+
+static uint8_t *find_avx2(uint8_t *head, uint8_t *last, int32_t unit, int32_t count)
+{
+	const __m256i s = _mm256_set1_epi8(ts_sync::SYNC_BYTE);
+	int32_t probe = (count < ts_sync::PROBE) ? count : static_cast<int32_t>(ts_sync::PROBE);
+	uint8_t *p = head;
+
+	while (p + 32 <= last + 1) {
+		__m256i m = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), s);
+		uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+		if (bits != 0) {
+			for (int32_t i = 1; i < probe; ++i) {
+				m = _mm256_and_si256(m, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + unit * i)), s));
+			}
+			bits = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+			while (bits != 0) {
+				uint8_t *q = p + ts_sync::lowest_bit(bits);
+				if (ts_sync::verify(q, unit, count)) {
+					return q;
+				}
+				bits &= bits - 1;
+			}
+		}
+		p += 32;
+	}
+
+	for (; p <= last; ++p) {
+		if (ts_sync::match(p, unit, count)) {
+			return p;
+		}
+	}
+
+	return NULL;
+}
+
+/* horizontal sum of 32 byte counters */
+static inline int32_t lane_sum(__m256i c)
+{
+	__m256i v = _mm256_sad_epu8(c, _mm256_setzero_si256());
+	__m128i w = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+	return _mm_cvtsi128_si32(w) + _mm_extract_epi32(w, 2);
+}
+
+static void count_pairs_avx2(const uint8_t *head, const uint8_t *tail, int32_t *count)
+{
+	const __m256i s = _mm256_set1_epi8(ts_sync::SYNC_BYTE);
+	const __m256i zero = _mm256_setzero_si256();
+	const uint8_t *p = head;
+
+	count[0] = count[1] = count[2] = 0;
+
+	/* every lane has all three partners inside [head,tail) */
+	while (p + 32 + ts_sync::pair_unit[2] <= tail) {
+		/* byte counters, counting up by subtracting -1, folded before they can wrap */
+		__m256i c0 = zero;
+		__m256i c1 = zero;
+		__m256i c2 = zero;
+		for (int i = 0; (i < 255) && (p + 32 + ts_sync::pair_unit[2] <= tail); ++i) {
+			__m256i m = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), s);
+			c0 = _mm256_sub_epi8(c0, _mm256_and_si256(m, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + ts_sync::pair_unit[0])), s)));
+			c1 = _mm256_sub_epi8(c1, _mm256_and_si256(m, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + ts_sync::pair_unit[1])), s)));
+			c2 = _mm256_sub_epi8(c2, _mm256_and_si256(m, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + ts_sync::pair_unit[2])), s)));
+			p += 32;
+		}
+		count[0] += lane_sum(c0);
+		count[1] += lane_sum(c1);
+		count[2] += lane_sum(c2);
+	}
+
+	ts_sync::count_pairs_from(p, tail, count);
+}
+
+const TS_SYNC_SCANNER ts_sync::avx2 = {
+	find_avx2,
+	count_pairs_avx2,
+};